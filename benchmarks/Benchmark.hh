@@ -0,0 +1,140 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#ifndef BENCHMARKS_BENCHMARK_HH
+#define BENCHMARKS_BENCHMARK_HH
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "Sandals.hh"
+
+using namespace Sandals;
+
+/* Shared utilities for the benchmark executables.
+
+Each benchmark collects its results in a table whose rows are a list of named fields. The table
+can be printed on the standard output or written to disk as CSV and JSON files, so that the results
+can be post-processed and compared across revisions of the library.
+*/
+class BenchmarkTable
+{
+public:
+  struct Field
+  {
+    std::string name;  // Field name
+    std::string value; // Field value (already formatted)
+    bool is_string;    // True if the field must be quoted
+  };
+
+  using Row = std::vector<Field>;
+
+private:
+  std::string      m_name; // Table name
+  std::vector<Row> m_rows; // Table rows
+
+public:
+  BenchmarkTable(std::string const &t_name) : m_name(t_name) {}
+
+  std::string const & name() const {return this->m_name;}
+
+  std::vector<Row> const & rows() const {return this->m_rows;}
+
+  void add_row(Row const &row) {this->m_rows.push_back(row);}
+
+  static Field field(std::string const &name, std::string const &value) {return {name, value, true};}
+
+  static Field field(std::string const &name, char const *value) {return {name, value, true};}
+
+  static Field field(std::string const &name, bool value) {return {name, value ? "true" : "false", false};}
+
+  template<typename Number>
+  static Field field(std::string const &name, Number value)
+  {
+    std::ostringstream os;
+    if (!std::isfinite(static_cast<double>(value))) {return {name, "null", false};}
+    os << std::setprecision(10) << value;
+    return {name, os.str(), false};
+  }
+
+  void print(std::ostream &os) const
+  {
+    if (this->m_rows.empty()) {return;}
+    for (Field const &f : this->m_rows.front()) {os << std::setw(16) << f.name.substr(0, 15);}
+    os << std::endl;
+    for (Row const &row : this->m_rows) {
+      for (Field const &f : row) {os << std::setw(16) << f.value.substr(0, 15);}
+      os << std::endl;
+    }
+  }
+
+  bool write_csv(std::string const &path) const
+  {
+    std::ofstream file(path);
+    if (!file.is_open()) {return false;}
+    if (this->m_rows.empty()) {return true;}
+    Row const &header = this->m_rows.front();
+    for (std::size_t i{0}; i < header.size(); ++i) {file << (i > 0 ? "," : "") << header[i].name;}
+    file << "\n";
+    for (Row const &row : this->m_rows) {
+      for (std::size_t i{0}; i < row.size(); ++i) {
+        file << (i > 0 ? "," : "") << (row[i].value == "null" ? "" : row[i].value);
+      }
+      file << "\n";
+    }
+    return true;
+  }
+
+  bool write_json(std::string const &path) const
+  {
+    std::ofstream file(path);
+    if (!file.is_open()) {return false;}
+    file << "{\n  \"benchmark\": \"" << this->m_name << "\",\n  \"results\": [";
+    for (std::size_t j{0}; j < this->m_rows.size(); ++j) {
+      file << (j > 0 ? ",\n    {" : "\n    {");
+      Row const &row = this->m_rows[j];
+      for (std::size_t i{0}; i < row.size(); ++i) {
+        file << (i > 0 ? ", " : "") << "\"" << row[i].name << "\": ";
+        if (row[i].is_string) {file << "\"" << row[i].value << "\"";}
+        else {file << row[i].value;}
+      }
+      file << "}";
+    }
+    file << "\n  ]\n}\n";
+    return true;
+  }
+
+  bool write(std::string const &prefix) const
+  {
+    return this->write_csv(prefix + ".csv") && this->write_json(prefix + ".json");
+  }
+};
+
+/* Significant correct digits of a solution with respect to a reference solution.
+
+The score is the negative base-10 logarithm of the largest relative error over the components, as
+in the IVP test set, so that components of very different magnitude are weighted alike. The score
+is infinite if the solution matches the reference exactly.
+*/
+template<typename VectorA, typename VectorB>
+double significant_digits(VectorA const &x, VectorB const &reference)
+{
+  double error{0.0};
+  for (Eigen::Index i{0}; i < reference.size(); ++i) {
+    error = std::max(error, std::abs(static_cast<double>(x(i) - reference(i)) /
+      static_cast<double>(reference(i))));
+  }
+  return -std::log10(error);
+}
+
+#endif // BENCHMARKS_BENCHMARK_HH
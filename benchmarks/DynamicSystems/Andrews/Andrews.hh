@@ -0,0 +1,1644 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// C++ generated code for implicit system: Andrews
+// This file has been automatically generated by Sandals.
+// DISCLAIMER: If you need to edit it, do it wisely!
+
+#ifndef SANDALS_MAPLE_ANDREWS_IMPLICIT_HH
+#define SANDALS_MAPLE_ANDREWS_IMPLICIT_HH
+
+using namespace Sandals;
+using namespace std;
+
+// No class description available.
+template<typename Real = double>
+class Andrews : public Implicit<Real, 20, 0>
+{
+  // Class data
+  Real m_m1{.04325}; // Data variable 1
+  Real m_m2{.00365}; // Data variable 2
+  Real m_m3{.02373}; // Data variable 3
+  Real m_m4{.00706}; // Data variable 4
+  Real m_m5{.0705}; // Data variable 5
+  Real m_m6{.00706}; // Data variable 6
+  Real m_m7{.05498}; // Data variable 7
+  Real m_xa{-.06934}; // Data variable 8
+  Real m_ya{-.00227}; // Data variable 9
+  Real m_xb{-.03635}; // Data variable 10
+  Real m_yb{.03273}; // Data variable 11
+  Real m_xc{.014}; // Data variable 12
+  Real m_yc{.072}; // Data variable 13
+  Real m_c0{4530.0}; // Data variable 14
+  Real m_I1{.2194e-5}; // Data variable 15
+  Real m_I2{.441e-6}; // Data variable 16
+  Real m_I3{.5255e-5}; // Data variable 17
+  Real m_I4{.5667e-6}; // Data variable 18
+  Real m_I5{.1169e-4}; // Data variable 19
+  Real m_I6{.5667e-6}; // Data variable 20
+  Real m_I7{.1912e-4}; // Data variable 21
+  Real m_d{.028}; // Data variable 22
+  Real m_da{.0115}; // Data variable 23
+  Real m_e{.02}; // Data variable 24
+  Real m_ea{.01421}; // Data variable 25
+  Real m_rr{.007}; // Data variable 26
+  Real m_ra{.92e-3}; // Data variable 27
+  Real m_l0{.07785}; // Data variable 28
+  Real m_ss{.035}; // Data variable 29
+  Real m_sa{.01874}; // Data variable 30
+  Real m_sb{.01043}; // Data variable 31
+  Real m_sc{.018}; // Data variable 32
+  Real m_sd{.02}; // Data variable 33
+  Real m_ta{.02308}; // Data variable 34
+  Real m_tb{.00916}; // Data variable 35
+  Real m_u{.04}; // Data variable 36
+  Real m_ua{.01228}; // Data variable 37
+  Real m_ub{.00449}; // Data variable 38
+  Real m_zf{.02}; // Data variable 39
+  Real m_zt{.04}; // Data variable 40
+  Real m_fa{.01421}; // Data variable 41
+  Real m_mom{.033}; // Data variable 42
+
+public:
+  using VectorF  = typename Implicit<Real, 20, 0>::VectorF;
+  using MatrixJF = typename Implicit<Real, 20, 0>::MatrixJF;
+  using VectorH  = typename Implicit<Real, 20, 0>::VectorH;
+  using MatrixJH = typename Implicit<Real, 20, 0>::MatrixJH;
+
+  // Class constructor.
+  Andrews() : Implicit<Real, 20, 0>("Andrews") {}
+
+  // Data variable 1 getter.
+  Real get_m1() const {return this->m_m1;}
+
+  // Data variable 1 setter.
+  void set_m1(Real t_m1) {this->m_m1 = t_m1;}
+
+  // Data variable 2 getter.
+  Real get_m2() const {return this->m_m2;}
+
+  // Data variable 2 setter.
+  void set_m2(Real t_m2) {this->m_m2 = t_m2;}
+
+  // Data variable 3 getter.
+  Real get_m3() const {return this->m_m3;}
+
+  // Data variable 3 setter.
+  void set_m3(Real t_m3) {this->m_m3 = t_m3;}
+
+  // Data variable 4 getter.
+  Real get_m4() const {return this->m_m4;}
+
+  // Data variable 4 setter.
+  void set_m4(Real t_m4) {this->m_m4 = t_m4;}
+
+  // Data variable 5 getter.
+  Real get_m5() const {return this->m_m5;}
+
+  // Data variable 5 setter.
+  void set_m5(Real t_m5) {this->m_m5 = t_m5;}
+
+  // Data variable 6 getter.
+  Real get_m6() const {return this->m_m6;}
+
+  // Data variable 6 setter.
+  void set_m6(Real t_m6) {this->m_m6 = t_m6;}
+
+  // Data variable 7 getter.
+  Real get_m7() const {return this->m_m7;}
+
+  // Data variable 7 setter.
+  void set_m7(Real t_m7) {this->m_m7 = t_m7;}
+
+  // Data variable 8 getter.
+  Real get_xa() const {return this->m_xa;}
+
+  // Data variable 8 setter.
+  void set_xa(Real t_xa) {this->m_xa = t_xa;}
+
+  // Data variable 9 getter.
+  Real get_ya() const {return this->m_ya;}
+
+  // Data variable 9 setter.
+  void set_ya(Real t_ya) {this->m_ya = t_ya;}
+
+  // Data variable 10 getter.
+  Real get_xb() const {return this->m_xb;}
+
+  // Data variable 10 setter.
+  void set_xb(Real t_xb) {this->m_xb = t_xb;}
+
+  // Data variable 11 getter.
+  Real get_yb() const {return this->m_yb;}
+
+  // Data variable 11 setter.
+  void set_yb(Real t_yb) {this->m_yb = t_yb;}
+
+  // Data variable 12 getter.
+  Real get_xc() const {return this->m_xc;}
+
+  // Data variable 12 setter.
+  void set_xc(Real t_xc) {this->m_xc = t_xc;}
+
+  // Data variable 13 getter.
+  Real get_yc() const {return this->m_yc;}
+
+  // Data variable 13 setter.
+  void set_yc(Real t_yc) {this->m_yc = t_yc;}
+
+  // Data variable 14 getter.
+  Real get_c0() const {return this->m_c0;}
+
+  // Data variable 14 setter.
+  void set_c0(Real t_c0) {this->m_c0 = t_c0;}
+
+  // Data variable 15 getter.
+  Real get_I1() const {return this->m_I1;}
+
+  // Data variable 15 setter.
+  void set_I1(Real t_I1) {this->m_I1 = t_I1;}
+
+  // Data variable 16 getter.
+  Real get_I2() const {return this->m_I2;}
+
+  // Data variable 16 setter.
+  void set_I2(Real t_I2) {this->m_I2 = t_I2;}
+
+  // Data variable 17 getter.
+  Real get_I3() const {return this->m_I3;}
+
+  // Data variable 17 setter.
+  void set_I3(Real t_I3) {this->m_I3 = t_I3;}
+
+  // Data variable 18 getter.
+  Real get_I4() const {return this->m_I4;}
+
+  // Data variable 18 setter.
+  void set_I4(Real t_I4) {this->m_I4 = t_I4;}
+
+  // Data variable 19 getter.
+  Real get_I5() const {return this->m_I5;}
+
+  // Data variable 19 setter.
+  void set_I5(Real t_I5) {this->m_I5 = t_I5;}
+
+  // Data variable 20 getter.
+  Real get_I6() const {return this->m_I6;}
+
+  // Data variable 20 setter.
+  void set_I6(Real t_I6) {this->m_I6 = t_I6;}
+
+  // Data variable 21 getter.
+  Real get_I7() const {return this->m_I7;}
+
+  // Data variable 21 setter.
+  void set_I7(Real t_I7) {this->m_I7 = t_I7;}
+
+  // Data variable 22 getter.
+  Real get_d() const {return this->m_d;}
+
+  // Data variable 22 setter.
+  void set_d(Real t_d) {this->m_d = t_d;}
+
+  // Data variable 23 getter.
+  Real get_da() const {return this->m_da;}
+
+  // Data variable 23 setter.
+  void set_da(Real t_da) {this->m_da = t_da;}
+
+  // Data variable 24 getter.
+  Real get_e() const {return this->m_e;}
+
+  // Data variable 24 setter.
+  void set_e(Real t_e) {this->m_e = t_e;}
+
+  // Data variable 25 getter.
+  Real get_ea() const {return this->m_ea;}
+
+  // Data variable 25 setter.
+  void set_ea(Real t_ea) {this->m_ea = t_ea;}
+
+  // Data variable 26 getter.
+  Real get_rr() const {return this->m_rr;}
+
+  // Data variable 26 setter.
+  void set_rr(Real t_rr) {this->m_rr = t_rr;}
+
+  // Data variable 27 getter.
+  Real get_ra() const {return this->m_ra;}
+
+  // Data variable 27 setter.
+  void set_ra(Real t_ra) {this->m_ra = t_ra;}
+
+  // Data variable 28 getter.
+  Real get_l0() const {return this->m_l0;}
+
+  // Data variable 28 setter.
+  void set_l0(Real t_l0) {this->m_l0 = t_l0;}
+
+  // Data variable 29 getter.
+  Real get_ss() const {return this->m_ss;}
+
+  // Data variable 29 setter.
+  void set_ss(Real t_ss) {this->m_ss = t_ss;}
+
+  // Data variable 30 getter.
+  Real get_sa() const {return this->m_sa;}
+
+  // Data variable 30 setter.
+  void set_sa(Real t_sa) {this->m_sa = t_sa;}
+
+  // Data variable 31 getter.
+  Real get_sb() const {return this->m_sb;}
+
+  // Data variable 31 setter.
+  void set_sb(Real t_sb) {this->m_sb = t_sb;}
+
+  // Data variable 32 getter.
+  Real get_sc() const {return this->m_sc;}
+
+  // Data variable 32 setter.
+  void set_sc(Real t_sc) {this->m_sc = t_sc;}
+
+  // Data variable 33 getter.
+  Real get_sd() const {return this->m_sd;}
+
+  // Data variable 33 setter.
+  void set_sd(Real t_sd) {this->m_sd = t_sd;}
+
+  // Data variable 34 getter.
+  Real get_ta() const {return this->m_ta;}
+
+  // Data variable 34 setter.
+  void set_ta(Real t_ta) {this->m_ta = t_ta;}
+
+  // Data variable 35 getter.
+  Real get_tb() const {return this->m_tb;}
+
+  // Data variable 35 setter.
+  void set_tb(Real t_tb) {this->m_tb = t_tb;}
+
+  // Data variable 36 getter.
+  Real get_u() const {return this->m_u;}
+
+  // Data variable 36 setter.
+  void set_u(Real t_u) {this->m_u = t_u;}
+
+  // Data variable 37 getter.
+  Real get_ua() const {return this->m_ua;}
+
+  // Data variable 37 setter.
+  void set_ua(Real t_ua) {this->m_ua = t_ua;}
+
+  // Data variable 38 getter.
+  Real get_ub() const {return this->m_ub;}
+
+  // Data variable 38 setter.
+  void set_ub(Real t_ub) {this->m_ub = t_ub;}
+
+  // Data variable 39 getter.
+  Real get_zf() const {return this->m_zf;}
+
+  // Data variable 39 setter.
+  void set_zf(Real t_zf) {this->m_zf = t_zf;}
+
+  // Data variable 40 getter.
+  Real get_zt() const {return this->m_zt;}
+
+  // Data variable 40 setter.
+  void set_zt(Real t_zt) {this->m_zt = t_zt;}
+
+  // Data variable 41 getter.
+  Real get_fa() const {return this->m_fa;}
+
+  // Data variable 41 setter.
+  void set_fa(Real t_fa) {this->m_fa = t_fa;}
+
+  // Data variable 42 getter.
+  Real get_mom() const {return this->m_mom;}
+
+  // Data variable 42 setter.
+  void set_mom(Real t_mom) {this->m_mom = t_mom;}
+
+  // Evaluate the function F.
+  VectorF F(VectorF const & in_0, VectorF const & in_1, Real /*in_2*/) const override
+  {
+    // Create data' aliases
+    Real const & m1 = this->m_m1; // Data variable 1
+    Real const & m2 = this->m_m2; // Data variable 2
+    Real const & m3 = this->m_m3; // Data variable 3
+    Real const & m4 = this->m_m4; // Data variable 4
+    Real const & m5 = this->m_m5; // Data variable 5
+    Real const & m6 = this->m_m6; // Data variable 6
+    Real const & m7 = this->m_m7; // Data variable 7
+    Real const & xb = this->m_xb; // Data variable 10
+    Real const & yb = this->m_yb; // Data variable 11
+    Real const & xc = this->m_xc; // Data variable 12
+    Real const & yc = this->m_yc; // Data variable 13
+    Real const & c0 = this->m_c0; // Data variable 14
+    Real const & I1 = this->m_I1; // Data variable 15
+    Real const & I2 = this->m_I2; // Data variable 16
+    Real const & I3 = this->m_I3; // Data variable 17
+    Real const & I4 = this->m_I4; // Data variable 18
+    Real const & I5 = this->m_I5; // Data variable 19
+    Real const & I6 = this->m_I6; // Data variable 20
+    Real const & I7 = this->m_I7; // Data variable 21
+    Real const & d = this->m_d; // Data variable 22
+    Real const & da = this->m_da; // Data variable 23
+    Real const & e = this->m_e; // Data variable 24
+    Real const & ea = this->m_ea; // Data variable 25
+    Real const & rr = this->m_rr; // Data variable 26
+    Real const & ra = this->m_ra; // Data variable 27
+    Real const & l0 = this->m_l0; // Data variable 28
+    Real const & ss = this->m_ss; // Data variable 29
+    Real const & sa = this->m_sa; // Data variable 30
+    Real const & sb = this->m_sb; // Data variable 31
+    Real const & sc = this->m_sc; // Data variable 32
+    Real const & sd = this->m_sd; // Data variable 33
+    Real const & ta = this->m_ta; // Data variable 34
+    Real const & tb = this->m_tb; // Data variable 35
+    Real const & u = this->m_u; // Data variable 36
+    Real const & ua = this->m_ua; // Data variable 37
+    Real const & ub = this->m_ub; // Data variable 38
+    Real const & zf = this->m_zf; // Data variable 39
+    Real const & zt = this->m_zt; // Data variable 40
+    Real const & fa = this->m_fa; // Data variable 41
+    Real const & mom = this->m_mom; // Data variable 42
+
+    // Create inputs' aliases
+    Real const & y_1 = in_0(0); // State variable 1
+    Real const & y_2 = in_0(1); // State variable 2
+    Real const & y_3 = in_0(2); // State variable 3
+    Real const & y_4 = in_0(3); // State variable 4
+    Real const & y_5 = in_0(4); // State variable 5
+    Real const & y_6 = in_0(5); // State variable 6
+    Real const & y_7 = in_0(6); // State variable 7
+    Real const & y_8 = in_0(7); // State variable 8
+    Real const & y_9 = in_0(8); // State variable 9
+    Real const & y_10 = in_0(9); // State variable 10
+    Real const & y_11 = in_0(10); // State variable 11
+    Real const & y_12 = in_0(11); // State variable 12
+    Real const & y_13 = in_0(12); // State variable 13
+    Real const & y_14 = in_0(13); // State variable 14
+    Real const & y_15 = in_0(14); // State variable 15
+    Real const & y_16 = in_0(15); // State variable 16
+    Real const & y_17 = in_0(16); // State variable 17
+    Real const & y_18 = in_0(17); // State variable 18
+    Real const & y_19 = in_0(18); // State variable 19
+    Real const & y_20 = in_0(19); // State variable 20
+    Real const & y_1_dot = in_1(0); // State variable 1 derivative
+    Real const & y_2_dot = in_1(1); // State variable 2 derivative
+    Real const & y_3_dot = in_1(2); // State variable 3 derivative
+    Real const & y_4_dot = in_1(3); // State variable 4 derivative
+    Real const & y_5_dot = in_1(4); // State variable 5 derivative
+    Real const & y_6_dot = in_1(5); // State variable 6 derivative
+    Real const & y_7_dot = in_1(6); // State variable 7 derivative
+    Real const & y_8_dot = in_1(7); // State variable 8 derivative
+    Real const & y_9_dot = in_1(8); // State variable 9 derivative
+    Real const & y_10_dot = in_1(9); // State variable 10 derivative
+    Real const & y_11_dot = in_1(10); // State variable 11 derivative
+    Real const & y_12_dot = in_1(11); // State variable 12 derivative
+    Real const & y_13_dot = in_1(12); // State variable 13 derivative
+    Real const & y_14_dot = in_1(13); // State variable 14 derivative
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real t1 = da * m2;
+    Real t2 = rr * t1 * sin(y_2);
+    Real t3 = y_1 + y_2;
+    Real t4 = sin(t3);
+    Real t5 = d * t4;
+    Real t6 = -rr * sin(y_1) + t5;
+    Real t7 = rr * cos(y_2);
+    Real t8 = I2 + t1 * (da - t7);
+    Real t9 = d * cos(t3);
+    Real t10 = -rr * cos(y_1) + t9;
+    Real t11 = da * da;
+    Real t12 = cos(y_3);
+    Real t13 = ss * t12;
+    Real t14 = sin(y_3);
+    Real t15 = ss * t14;
+    Real t16 = sc * t12 - sd * t14;
+    Real t17 = sc * t14 + sd * t12;
+    Real t18 = t17 + xb - xc;
+    Real t19 = t18 * t18;
+    Real t20 = t16 - yb + yc;
+    Real t21 = 0.1e1 / sqrt(t19 + t20 * t20);
+    Real t22 = l0 - sqrt(t19 + t20 * t20);
+    Real t23 = y_4 + y_5;
+    Real t24 = e * cos(t23);
+    Real t25 = e * sin(t23);
+    Real t26 = e - ea;
+    Real t27 = m4 * t26;
+    Real t28 = t27 * zt * cos(y_4);
+    Real t29 = t26 * t26;
+    Real t30 = zt * sin(y_4);
+    Real t31 = I4 + t27 * (t26 + t30);
+    Real t32 = t25 + zt * cos(y_5);
+    Real t33 = t24 - zt * sin(y_5);
+    Real t34 = y_6 + y_7;
+    Real t35 = zf * sin(t34);
+    Real t36 = zf * cos(t34);
+    Real t37 = fa - zf;
+    Real t38 = t37 * t37;
+    Real t39 = m6 * t37;
+    Real t40 = t39 * u * cos(y_6);
+    Real t41 = u * sin(y_6);
+    Real t42 = I6 + t39 * (t37 + t41);
+    Real t43 = t36 + u * sin(y_7);
+    Real t44 = -t35 + u * cos(y_7);
+    Real t45 = y_10 * y_10;
+    Real t46 = t9 * y_9;
+    Real t47 = y_8 + y_9;
+    Real t48 = t46 * t47 + t5 * y_9_dot + t6 * y_8_dot + y_8 * (t10 * y_8 + t46);
+    Real t49 = t10 * y_8_dot;
+    Real t50 = t5 * y_9;
+    Real t51 = t50 + t6 * y_8;
+    Real t52 = t9 * y_9_dot;
+    Real t53 = -d * t4 * t47 * y_9 + t49 - t51 * y_8 + t52;
+    Real t54 = t25 * y_11;
+    Real t55 = y_11 + y_12;
+    Real t56 = t24 * y_11;
+    Real t57 = t36 * y_13;
+    Real t58 = y_13 + y_14;
+    Real t59 = t35 * y_13;
+    Real out_0 = y_1_dot - y_8;
+    Real out_1 = y_2_dot - y_9;
+    Real out_2 = -y_10 + y_3_dot;
+    Real out_3 = -y_11 + y_4_dot;
+    Real out_4 = -y_12 + y_5_dot;
+    Real out_5 = -y_13 + y_6_dot;
+    Real out_6 = -y_14 + y_7_dot;
+    Real out_7 = -mom - t10 * y_16 - t10 * y_18 - t10 * y_20 + t2 * y_9 * (2 * y_8 + y_9) + t6 * y_15 + t6 * y_17 + t6 * y_19 + t8 * y_9_dot + y_8_dot * (I1 + I2 + m1 * ra * ra + m2 * (-2 * da * t7 + rr * rr + t11));
+    Real out_8 = -t2 * y_8 * y_8 + t5 * y_15 + t5 * y_17 + t5 * y_19 + t8 * y_8_dot - t9 * y_16 - t9 * y_18 - t9 * y_20 + y_9_dot * (I2 + m2 * t11);
+    Real out_9 = -c0 * t16 * t18 * t21 * t22 + c0 * t17 * t20 * t21 * t22 - t13 * y_15 - t15 * y_16 + y_10_dot * (I3 + m3 * (sa * sa + sb * sb));
+    Real out_10 = -t24 * y_17 - t25 * y_18 - t28 * y_12 * y_12 + t31 * y_12_dot + y_11_dot * (I4 + m4 * t29);
+    Real out_11 = t28 * y_11 * (y_11 + 2 * y_12) + t31 * y_11_dot - t32 * y_18 - t33 * y_17 + y_12_dot * (I4 + I5 + m4 * (2 * t26 * t30 + t29 + zt * zt) + m5 * (ta * ta + tb * tb));
+    Real out_12 = t35 * y_19 - t36 * y_20 - t40 * y_14 * y_14 + t42 * y_14_dot + y_13_dot * (I6 + m6 * t38);
+    Real out_13 = t40 * y_13 * (y_13 + 2 * y_14) + t42 * y_13_dot - t43 * y_20 - t44 * y_19 + y_14_dot * (I6 + I7 + m6 * (2 * t37 * t41 + t38 + u * u) + m7 * (ua * ua + ub * ub));
+    Real out_14 = -t13 * y_10_dot + t15 * t45 + t48;
+    Real out_15 = -t13 * t45 - t15 * y_10_dot - t53;
+    Real out_16 = -t24 * y_11_dot - t33 * y_12_dot + t48 + t54 * t55 + y_12 * (t32 * y_12 + t54);
+    Real out_17 = -t25 * y_11_dot - t32 * y_12_dot - t53 - t55 * t56 - y_12 * (t33 * y_12 + t56);
+    Real out_18 = t35 * y_13_dot - t44 * y_14_dot + t48 + t57 * t58 + y_14 * (t43 * y_14 + t57);
+    Real out_19 = -t36 * y_13_dot - t43 * y_14_dot + t47 * t50 - t49 + t51 * y_8 - t52 + t58 * t59 + y_14 * (-t44 * y_14 + t59);
+
+    // Return results
+    VectorF out_F;
+    out_F <<
+      out_0, out_1, out_2, out_3, out_4, out_5, out_6, out_7, out_8, out_9, out_10, out_11, out_12, out_13, out_14, out_15, out_16, out_17, out_18, out_19;
+    return out_F;
+  }
+
+  // Evaluate the Jacobian of F with respect to x.
+  MatrixJF JF_x(VectorF const & in_0, VectorF const & in_1, Real /*in_2*/) const override
+  {
+    // Create data' aliases
+    Real const & m2 = this->m_m2; // Data variable 2
+    Real const & m4 = this->m_m4; // Data variable 4
+    Real const & m6 = this->m_m6; // Data variable 6
+    Real const & xb = this->m_xb; // Data variable 10
+    Real const & yb = this->m_yb; // Data variable 11
+    Real const & xc = this->m_xc; // Data variable 12
+    Real const & yc = this->m_yc; // Data variable 13
+    Real const & c0 = this->m_c0; // Data variable 14
+    Real const & d = this->m_d; // Data variable 22
+    Real const & da = this->m_da; // Data variable 23
+    Real const & e = this->m_e; // Data variable 24
+    Real const & ea = this->m_ea; // Data variable 25
+    Real const & rr = this->m_rr; // Data variable 26
+    Real const & l0 = this->m_l0; // Data variable 28
+    Real const & ss = this->m_ss; // Data variable 29
+    Real const & sc = this->m_sc; // Data variable 32
+    Real const & sd = this->m_sd; // Data variable 33
+    Real const & u = this->m_u; // Data variable 36
+    Real const & zf = this->m_zf; // Data variable 39
+    Real const & zt = this->m_zt; // Data variable 40
+    Real const & fa = this->m_fa; // Data variable 41
+
+    // Create inputs' aliases
+    Real const & y_1 = in_0(0); // State variable 1
+    Real const & y_2 = in_0(1); // State variable 2
+    Real const & y_3 = in_0(2); // State variable 3
+    Real const & y_4 = in_0(3); // State variable 4
+    Real const & y_5 = in_0(4); // State variable 5
+    Real const & y_6 = in_0(5); // State variable 6
+    Real const & y_7 = in_0(6); // State variable 7
+    Real const & y_8 = in_0(7); // State variable 8
+    Real const & y_9 = in_0(8); // State variable 9
+    Real const & y_10 = in_0(9); // State variable 10
+    Real const & y_11 = in_0(10); // State variable 11
+    Real const & y_12 = in_0(11); // State variable 12
+    Real const & y_13 = in_0(12); // State variable 13
+    Real const & y_14 = in_0(13); // State variable 14
+    Real const & y_15 = in_0(14); // State variable 15
+    Real const & y_16 = in_0(15); // State variable 16
+    Real const & y_17 = in_0(16); // State variable 17
+    Real const & y_18 = in_0(17); // State variable 18
+    Real const & y_19 = in_0(18); // State variable 19
+    Real const & y_20 = in_0(19); // State variable 20
+    Real const & y_8_dot = in_1(7); // State variable 8 derivative
+    Real const & y_9_dot = in_1(8); // State variable 9 derivative
+    Real const & y_10_dot = in_1(9); // State variable 10 derivative
+    Real const & y_11_dot = in_1(10); // State variable 11 derivative
+    Real const & y_12_dot = in_1(11); // State variable 12 derivative
+    Real const & y_13_dot = in_1(12); // State variable 13 derivative
+    Real const & y_14_dot = in_1(13); // State variable 14 derivative
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real t1 = y_1 + y_2;
+    Real t2 = cos(t1);
+    Real t3 = d * t2;
+    Real t4 = -rr * cos(y_1) + t3;
+    Real t5 = sin(t1);
+    Real t6 = d * t5;
+    Real t7 = -rr * sin(y_1) + t6;
+    Real t8 = da * m2 * rr;
+    Real t9 = t8 * sin(y_2);
+    Real t10 = t9 * y_8_dot;
+    Real t11 = 2 * y_8;
+    Real t12 = t8 * cos(y_2);
+    Real t13 = t3 * y_15 + t3 * y_17 + t3 * y_19 + t6 * y_16 + t6 * y_18 + t6 * y_20;
+    Real t14 = 2 * y_9;
+    Real t15 = -t4;
+    Real t16 = -t3;
+    Real t17 = cos(y_3);
+    Real t18 = ss * t17;
+    Real t19 = sin(y_3);
+    Real t20 = sc * t19 + sd * t17;
+    Real t21 = t20 + xb - xc;
+    Real t22 = t21 * t21;
+    Real t23 = sc * t17 - sd * t19;
+    Real t24 = t23 - yb + yc;
+    Real t25 = t22 + t24 * t24;
+    Real t26 = 0.1e1 / sqrt(t25);
+    Real t27 = -t24;
+    Real t28 = l0 - sqrt(t22 + t27 * t27);
+    Real t29 = c0 * t28;
+    Real t30 = t26 * t29;
+    Real t31 = t20 * t24;
+    Real t32 = 0.1e1 / t25;
+    Real t33 = t21 * t23 - t31;
+    Real t34 = pow(t25, -0.3e1 / 0.2e1);
+    Real t35 = t20 * t27 + t21 * t23;
+    Real t36 = ss * t19;
+    Real t37 = m4 * zt * (e - ea);
+    Real t38 = t37 * cos(y_4);
+    Real t39 = t38 * y_12_dot;
+    Real t40 = t37 * sin(y_4);
+    Real t41 = y_4 + y_5;
+    Real t42 = sin(t41);
+    Real t43 = t42 * y_17;
+    Real t44 = cos(t41);
+    Real t45 = t44 * y_18;
+    Real t46 = e * t43 - e * t45;
+    Real t47 = 2 * y_12;
+    Real t48 = e * t44;
+    Real t49 = e * t42;
+    Real t50 = t49 + zt * cos(y_5);
+    Real t51 = t48 - zt * sin(y_5);
+    Real t52 = 2 * y_11;
+    Real t53 = m6 * u * (fa - zf);
+    Real t54 = t53 * cos(y_6);
+    Real t55 = t54 * y_14_dot;
+    Real t56 = t53 * sin(y_6);
+    Real t57 = y_6 + y_7;
+    Real t58 = cos(t57);
+    Real t59 = t58 * y_19;
+    Real t60 = sin(t57);
+    Real t61 = t60 * y_20;
+    Real t62 = t59 * zf + t61 * zf;
+    Real t63 = 2 * y_14;
+    Real t64 = t60 * zf;
+    Real t65 = t58 * zf;
+    Real t66 = t65 + u * sin(y_7);
+    Real t67 = -t64 + u * cos(y_7);
+    Real t68 = 2 * y_13;
+    Real t69 = y_8 + y_9;
+    Real t70 = t6 * y_9;
+    Real t71 = t7 * y_8 + t70;
+    Real t72 = d * t2 * y_9_dot + t4 * y_8_dot - t69 * t70 - t71 * y_8;
+    Real t73 = t5 * t69;
+    Real t74 = d * (t2 * y_8_dot + t2 * y_9_dot - t73 * y_8 - t73 * y_9);
+    Real t75 = y_10 * y_10;
+    Real t76 = t3 * y_9;
+    Real t77 = t4 * y_8 + t76;
+    Real t78 = 2 * t77;
+    Real t79 = 2 * t69;
+    Real t80 = t3 * t79;
+    Real t81 = 2 * y_10;
+    Real t82 = t6 * y_9_dot + t69 * t76 + t7 * y_8_dot + t77 * y_8;
+    Real t83 = t2 * t69;
+    Real t84 = d * (t5 * y_8_dot + t5 * y_9_dot + t83 * y_8 + t83 * y_9);
+    Real t85 = 2 * t71;
+    Real t86 = t6 * t79;
+    Real t87 = y_11 + y_12;
+    Real t88 = t44 * t87;
+    Real t89 = t48 * y_11;
+    Real t90 = t51 * y_12 + t89;
+    Real t91 = 2 * t87;
+    Real t92 = t49 * y_11;
+    Real t93 = t50 * y_12 + t92;
+    Real t94 = t42 * t87;
+    Real t95 = y_13 + y_14;
+    Real t96 = t60 * t95;
+    Real t97 = t64 * y_13;
+    Real t98 = -t67 * y_14 + t97;
+    Real t99 = 2 * t95;
+    Real t100 = t65 * y_13;
+    Real t101 = t100 + t66 * y_14;
+    Real t102 = t58 * t95;
+    Real out_0_0 = 0;
+    Real out_0_1 = 0;
+    Real out_0_2 = 0;
+    Real out_0_3 = 0;
+    Real out_0_4 = 0;
+    Real out_0_5 = 0;
+    Real out_0_6 = 0;
+    Real out_0_7 = -1;
+    Real out_0_8 = 0;
+    Real out_0_9 = 0;
+    Real out_0_10 = 0;
+    Real out_0_11 = 0;
+    Real out_0_12 = 0;
+    Real out_0_13 = 0;
+    Real out_0_14 = 0;
+    Real out_0_15 = 0;
+    Real out_0_16 = 0;
+    Real out_0_17 = 0;
+    Real out_0_18 = 0;
+    Real out_0_19 = 0;
+    Real out_1_0 = 0;
+    Real out_1_1 = 0;
+    Real out_1_2 = 0;
+    Real out_1_3 = 0;
+    Real out_1_4 = 0;
+    Real out_1_5 = 0;
+    Real out_1_6 = 0;
+    Real out_1_7 = 0;
+    Real out_1_8 = -1;
+    Real out_1_9 = 0;
+    Real out_1_10 = 0;
+    Real out_1_11 = 0;
+    Real out_1_12 = 0;
+    Real out_1_13 = 0;
+    Real out_1_14 = 0;
+    Real out_1_15 = 0;
+    Real out_1_16 = 0;
+    Real out_1_17 = 0;
+    Real out_1_18 = 0;
+    Real out_1_19 = 0;
+    Real out_2_0 = 0;
+    Real out_2_1 = 0;
+    Real out_2_2 = 0;
+    Real out_2_3 = 0;
+    Real out_2_4 = 0;
+    Real out_2_5 = 0;
+    Real out_2_6 = 0;
+    Real out_2_7 = 0;
+    Real out_2_8 = 0;
+    Real out_2_9 = -1;
+    Real out_2_10 = 0;
+    Real out_2_11 = 0;
+    Real out_2_12 = 0;
+    Real out_2_13 = 0;
+    Real out_2_14 = 0;
+    Real out_2_15 = 0;
+    Real out_2_16 = 0;
+    Real out_2_17 = 0;
+    Real out_2_18 = 0;
+    Real out_2_19 = 0;
+    Real out_3_0 = 0;
+    Real out_3_1 = 0;
+    Real out_3_2 = 0;
+    Real out_3_3 = 0;
+    Real out_3_4 = 0;
+    Real out_3_5 = 0;
+    Real out_3_6 = 0;
+    Real out_3_7 = 0;
+    Real out_3_8 = 0;
+    Real out_3_9 = 0;
+    Real out_3_10 = -1;
+    Real out_3_11 = 0;
+    Real out_3_12 = 0;
+    Real out_3_13 = 0;
+    Real out_3_14 = 0;
+    Real out_3_15 = 0;
+    Real out_3_16 = 0;
+    Real out_3_17 = 0;
+    Real out_3_18 = 0;
+    Real out_3_19 = 0;
+    Real out_4_0 = 0;
+    Real out_4_1 = 0;
+    Real out_4_2 = 0;
+    Real out_4_3 = 0;
+    Real out_4_4 = 0;
+    Real out_4_5 = 0;
+    Real out_4_6 = 0;
+    Real out_4_7 = 0;
+    Real out_4_8 = 0;
+    Real out_4_9 = 0;
+    Real out_4_10 = 0;
+    Real out_4_11 = -1;
+    Real out_4_12 = 0;
+    Real out_4_13 = 0;
+    Real out_4_14 = 0;
+    Real out_4_15 = 0;
+    Real out_4_16 = 0;
+    Real out_4_17 = 0;
+    Real out_4_18 = 0;
+    Real out_4_19 = 0;
+    Real out_5_0 = 0;
+    Real out_5_1 = 0;
+    Real out_5_2 = 0;
+    Real out_5_3 = 0;
+    Real out_5_4 = 0;
+    Real out_5_5 = 0;
+    Real out_5_6 = 0;
+    Real out_5_7 = 0;
+    Real out_5_8 = 0;
+    Real out_5_9 = 0;
+    Real out_5_10 = 0;
+    Real out_5_11 = 0;
+    Real out_5_12 = -1;
+    Real out_5_13 = 0;
+    Real out_5_14 = 0;
+    Real out_5_15 = 0;
+    Real out_5_16 = 0;
+    Real out_5_17 = 0;
+    Real out_5_18 = 0;
+    Real out_5_19 = 0;
+    Real out_6_0 = 0;
+    Real out_6_1 = 0;
+    Real out_6_2 = 0;
+    Real out_6_3 = 0;
+    Real out_6_4 = 0;
+    Real out_6_5 = 0;
+    Real out_6_6 = 0;
+    Real out_6_7 = 0;
+    Real out_6_8 = 0;
+    Real out_6_9 = 0;
+    Real out_6_10 = 0;
+    Real out_6_11 = 0;
+    Real out_6_12 = 0;
+    Real out_6_13 = -1;
+    Real out_6_14 = 0;
+    Real out_6_15 = 0;
+    Real out_6_16 = 0;
+    Real out_6_17 = 0;
+    Real out_6_18 = 0;
+    Real out_6_19 = 0;
+    Real out_7_0 = t4 * y_15 + t4 * y_17 + t4 * y_19 + t7 * y_16 + t7 * y_18 + t7 * y_20;
+    Real out_7_1 = 2 * t10 + t12 * y_9 * (t11 + y_9) + t13 + t9 * y_9_dot;
+    Real out_7_2 = 0;
+    Real out_7_3 = 0;
+    Real out_7_4 = 0;
+    Real out_7_5 = 0;
+    Real out_7_6 = 0;
+    Real out_7_7 = t14 * t9;
+    Real out_7_8 = t9 * (t11 + t14);
+    Real out_7_9 = 0;
+    Real out_7_10 = 0;
+    Real out_7_11 = 0;
+    Real out_7_12 = 0;
+    Real out_7_13 = 0;
+    Real out_7_14 = t7;
+    Real out_7_15 = t15;
+    Real out_7_16 = t7;
+    Real out_7_17 = t15;
+    Real out_7_18 = t7;
+    Real out_7_19 = t15;
+    Real out_8_0 = d * (t2 * y_15 + t2 * y_17 + t2 * y_19 + t5 * y_16 + t5 * y_18 + t5 * y_20);
+    Real out_8_1 = t10 - t12 * y_8 * y_8 + t13;
+    Real out_8_2 = 0;
+    Real out_8_3 = 0;
+    Real out_8_4 = 0;
+    Real out_8_5 = 0;
+    Real out_8_6 = 0;
+    Real out_8_7 = -t11 * t9;
+    Real out_8_8 = 0;
+    Real out_8_9 = 0;
+    Real out_8_10 = 0;
+    Real out_8_11 = 0;
+    Real out_8_12 = 0;
+    Real out_8_13 = 0;
+    Real out_8_14 = t6;
+    Real out_8_15 = t16;
+    Real out_8_16 = t6;
+    Real out_8_17 = t16;
+    Real out_8_18 = t6;
+    Real out_8_19 = t16;
+    Real out_9_0 = 0;
+    Real out_9_1 = 0;
+    Real out_9_2 = c0 * t20 * t21 * t26 * t28 + c0 * t21 * t23 * t28 * t34 * t35 + c0 * t21 * t23 * t32 * t33 + c0 * t23 * t24 * t26 * t28 - c0 * t31 * t32 * t33 + ss * t19 * y_15 - t18 * y_16 - t20 * t20 * t30 - t23 * t23 * t30 - t29 * t31 * t34 * t35;
+    Real out_9_3 = 0;
+    Real out_9_4 = 0;
+    Real out_9_5 = 0;
+    Real out_9_6 = 0;
+    Real out_9_7 = 0;
+    Real out_9_8 = 0;
+    Real out_9_9 = 0;
+    Real out_9_10 = 0;
+    Real out_9_11 = 0;
+    Real out_9_12 = 0;
+    Real out_9_13 = 0;
+    Real out_9_14 = -t18;
+    Real out_9_15 = -t36;
+    Real out_9_16 = 0;
+    Real out_9_17 = 0;
+    Real out_9_18 = 0;
+    Real out_9_19 = 0;
+    Real out_10_0 = 0;
+    Real out_10_1 = 0;
+    Real out_10_2 = 0;
+    Real out_10_3 = t39 + t40 * y_12 * y_12 + t46;
+    Real out_10_4 = e * (t43 - t45);
+    Real out_10_5 = 0;
+    Real out_10_6 = 0;
+    Real out_10_7 = 0;
+    Real out_10_8 = 0;
+    Real out_10_9 = 0;
+    Real out_10_10 = 0;
+    Real out_10_11 = -t38 * t47;
+    Real out_10_12 = 0;
+    Real out_10_13 = 0;
+    Real out_10_14 = 0;
+    Real out_10_15 = 0;
+    Real out_10_16 = -t48;
+    Real out_10_17 = -t49;
+    Real out_10_18 = 0;
+    Real out_10_19 = 0;
+    Real out_11_0 = 0;
+    Real out_11_1 = 0;
+    Real out_11_2 = 0;
+    Real out_11_3 = t38 * y_11_dot + 2 * t39 - t40 * y_11 * (t47 + y_11) + t46;
+    Real out_11_4 = t50 * y_17 - t51 * y_18;
+    Real out_11_5 = 0;
+    Real out_11_6 = 0;
+    Real out_11_7 = 0;
+    Real out_11_8 = 0;
+    Real out_11_9 = 0;
+    Real out_11_10 = t38 * (t47 + t52);
+    Real out_11_11 = t38 * t52;
+    Real out_11_12 = 0;
+    Real out_11_13 = 0;
+    Real out_11_14 = 0;
+    Real out_11_15 = 0;
+    Real out_11_16 = -t51;
+    Real out_11_17 = -t50;
+    Real out_11_18 = 0;
+    Real out_11_19 = 0;
+    Real out_12_0 = 0;
+    Real out_12_1 = 0;
+    Real out_12_2 = 0;
+    Real out_12_3 = 0;
+    Real out_12_4 = 0;
+    Real out_12_5 = t55 + t56 * y_14 * y_14 + t62;
+    Real out_12_6 = zf * (t59 + t61);
+    Real out_12_7 = 0;
+    Real out_12_8 = 0;
+    Real out_12_9 = 0;
+    Real out_12_10 = 0;
+    Real out_12_11 = 0;
+    Real out_12_12 = 0;
+    Real out_12_13 = -t54 * t63;
+    Real out_12_14 = 0;
+    Real out_12_15 = 0;
+    Real out_12_16 = 0;
+    Real out_12_17 = 0;
+    Real out_12_18 = t64;
+    Real out_12_19 = -t65;
+    Real out_13_0 = 0;
+    Real out_13_1 = 0;
+    Real out_13_2 = 0;
+    Real out_13_3 = 0;
+    Real out_13_4 = 0;
+    Real out_13_5 = t54 * y_13_dot + 2 * t55 - t56 * y_13 * (t63 + y_13) + t62;
+    Real out_13_6 = t66 * y_19 - t67 * y_20;
+    Real out_13_7 = 0;
+    Real out_13_8 = 0;
+    Real out_13_9 = 0;
+    Real out_13_10 = 0;
+    Real out_13_11 = 0;
+    Real out_13_12 = t54 * (t63 + t68);
+    Real out_13_13 = t54 * t68;
+    Real out_13_14 = 0;
+    Real out_13_15 = 0;
+    Real out_13_16 = 0;
+    Real out_13_17 = 0;
+    Real out_13_18 = -t67;
+    Real out_13_19 = -t66;
+    Real out_14_0 = t72;
+    Real out_14_1 = t74;
+    Real out_14_2 = ss * (t17 * t75 + t19 * y_10_dot);
+    Real out_14_3 = 0;
+    Real out_14_4 = 0;
+    Real out_14_5 = 0;
+    Real out_14_6 = 0;
+    Real out_14_7 = t78;
+    Real out_14_8 = t80;
+    Real out_14_9 = t36 * t81;
+    Real out_14_10 = 0;
+    Real out_14_11 = 0;
+    Real out_14_12 = 0;
+    Real out_14_13 = 0;
+    Real out_14_14 = 0;
+    Real out_14_15 = 0;
+    Real out_14_16 = 0;
+    Real out_14_17 = 0;
+    Real out_14_18 = 0;
+    Real out_14_19 = 0;
+    Real out_15_0 = t82;
+    Real out_15_1 = t84;
+    Real out_15_2 = ss * (-t17 * y_10_dot + t19 * t75);
+    Real out_15_3 = 0;
+    Real out_15_4 = 0;
+    Real out_15_5 = 0;
+    Real out_15_6 = 0;
+    Real out_15_7 = t85;
+    Real out_15_8 = t86;
+    Real out_15_9 = -t18 * t81;
+    Real out_15_10 = 0;
+    Real out_15_11 = 0;
+    Real out_15_12 = 0;
+    Real out_15_13 = 0;
+    Real out_15_14 = 0;
+    Real out_15_15 = 0;
+    Real out_15_16 = 0;
+    Real out_15_17 = 0;
+    Real out_15_18 = 0;
+    Real out_15_19 = 0;
+    Real out_16_0 = t72;
+    Real out_16_1 = t74;
+    Real out_16_2 = 0;
+    Real out_16_3 = e * (t42 * y_11_dot + t42 * y_12_dot + t88 * y_11 + t88 * y_12);
+    Real out_16_4 = t49 * y_11_dot + t50 * y_12_dot + t87 * t89 + t90 * y_12;
+    Real out_16_5 = 0;
+    Real out_16_6 = 0;
+    Real out_16_7 = t78;
+    Real out_16_8 = t80;
+    Real out_16_9 = 0;
+    Real out_16_10 = t49 * t91;
+    Real out_16_11 = 2 * t93;
+    Real out_16_12 = 0;
+    Real out_16_13 = 0;
+    Real out_16_14 = 0;
+    Real out_16_15 = 0;
+    Real out_16_16 = 0;
+    Real out_16_17 = 0;
+    Real out_16_18 = 0;
+    Real out_16_19 = 0;
+    Real out_17_0 = t82;
+    Real out_17_1 = t84;
+    Real out_17_2 = 0;
+    Real out_17_3 = e * (-t44 * y_11_dot - t44 * y_12_dot + t94 * y_11 + t94 * y_12);
+    Real out_17_4 = -t48 * y_11_dot - t51 * y_12_dot + t87 * t92 + t93 * y_12;
+    Real out_17_5 = 0;
+    Real out_17_6 = 0;
+    Real out_17_7 = t85;
+    Real out_17_8 = t86;
+    Real out_17_9 = 0;
+    Real out_17_10 = -t48 * t91;
+    Real out_17_11 = -2 * t90;
+    Real out_17_12 = 0;
+    Real out_17_13 = 0;
+    Real out_17_14 = 0;
+    Real out_17_15 = 0;
+    Real out_17_16 = 0;
+    Real out_17_17 = 0;
+    Real out_17_18 = 0;
+    Real out_17_19 = 0;
+    Real out_18_0 = t72;
+    Real out_18_1 = t74;
+    Real out_18_2 = 0;
+    Real out_18_3 = 0;
+    Real out_18_4 = 0;
+    Real out_18_5 = zf * (t58 * y_13_dot + t58 * y_14_dot - t96 * y_13 - t96 * y_14);
+    Real out_18_6 = t58 * y_13_dot * zf + t66 * y_14_dot - t95 * t97 - t98 * y_14;
+    Real out_18_7 = t78;
+    Real out_18_8 = t80;
+    Real out_18_9 = 0;
+    Real out_18_10 = 0;
+    Real out_18_11 = 0;
+    Real out_18_12 = t65 * t99;
+    Real out_18_13 = 2 * t101;
+    Real out_18_14 = 0;
+    Real out_18_15 = 0;
+    Real out_18_16 = 0;
+    Real out_18_17 = 0;
+    Real out_18_18 = 0;
+    Real out_18_19 = 0;
+    Real out_19_0 = t82;
+    Real out_19_1 = t84;
+    Real out_19_2 = 0;
+    Real out_19_3 = 0;
+    Real out_19_4 = 0;
+    Real out_19_5 = zf * (t102 * y_13 + t102 * y_14 + t60 * y_13_dot + t60 * y_14_dot);
+    Real out_19_6 = t100 * t95 + t101 * y_14 + t64 * y_13_dot - t67 * y_14_dot;
+    Real out_19_7 = t85;
+    Real out_19_8 = t86;
+    Real out_19_9 = 0;
+    Real out_19_10 = 0;
+    Real out_19_11 = 0;
+    Real out_19_12 = t64 * t99;
+    Real out_19_13 = 2 * t98;
+    Real out_19_14 = 0;
+    Real out_19_15 = 0;
+    Real out_19_16 = 0;
+    Real out_19_17 = 0;
+    Real out_19_18 = 0;
+    Real out_19_19 = 0;
+
+    // Return results
+    MatrixJF out_JF_x;
+    out_JF_x <<
+      out_0_0, out_0_1, out_0_2, out_0_3, out_0_4, out_0_5, out_0_6, out_0_7, out_0_8, out_0_9, out_0_10, out_0_11, out_0_12, out_0_13, out_0_14, out_0_15, out_0_16, out_0_17, out_0_18, out_0_19, out_1_0, out_1_1, out_1_2, out_1_3, out_1_4, out_1_5, out_1_6, out_1_7, out_1_8, out_1_9, out_1_10, out_1_11, out_1_12, out_1_13, out_1_14, out_1_15, out_1_16, out_1_17, out_1_18, out_1_19, out_2_0, out_2_1, out_2_2, out_2_3, out_2_4, out_2_5, out_2_6, out_2_7, out_2_8, out_2_9, out_2_10, out_2_11, out_2_12, out_2_13, out_2_14, out_2_15, out_2_16, out_2_17, out_2_18, out_2_19, out_3_0, out_3_1, out_3_2, out_3_3, out_3_4, out_3_5, out_3_6, out_3_7, out_3_8, out_3_9, out_3_10, out_3_11, out_3_12, out_3_13, out_3_14, out_3_15, out_3_16, out_3_17, out_3_18, out_3_19, out_4_0, out_4_1, out_4_2, out_4_3, out_4_4, out_4_5, out_4_6, out_4_7, out_4_8, out_4_9, out_4_10, out_4_11, out_4_12, out_4_13, out_4_14, out_4_15, out_4_16, out_4_17, out_4_18, out_4_19, out_5_0, out_5_1, out_5_2, out_5_3, out_5_4, out_5_5, out_5_6, out_5_7, out_5_8, out_5_9, out_5_10, out_5_11, out_5_12, out_5_13, out_5_14, out_5_15, out_5_16, out_5_17, out_5_18, out_5_19, out_6_0, out_6_1, out_6_2, out_6_3, out_6_4, out_6_5, out_6_6, out_6_7, out_6_8, out_6_9, out_6_10, out_6_11, out_6_12, out_6_13, out_6_14, out_6_15, out_6_16, out_6_17, out_6_18, out_6_19, out_7_0, out_7_1, out_7_2, out_7_3, out_7_4, out_7_5, out_7_6, out_7_7, out_7_8, out_7_9, out_7_10, out_7_11, out_7_12, out_7_13, out_7_14, out_7_15, out_7_16, out_7_17, out_7_18, out_7_19, out_8_0, out_8_1, out_8_2, out_8_3, out_8_4, out_8_5, out_8_6, out_8_7, out_8_8, out_8_9, out_8_10, out_8_11, out_8_12, out_8_13, out_8_14, out_8_15, out_8_16, out_8_17, out_8_18, out_8_19, out_9_0, out_9_1, out_9_2, out_9_3, out_9_4, out_9_5, out_9_6, out_9_7, out_9_8, out_9_9, out_9_10, out_9_11, out_9_12, out_9_13, out_9_14, out_9_15, out_9_16, out_9_17, out_9_18, out_9_19, out_10_0, out_10_1, out_10_2, out_10_3, out_10_4, out_10_5, out_10_6, out_10_7, out_10_8, out_10_9, out_10_10, out_10_11, out_10_12, out_10_13, out_10_14, out_10_15, out_10_16, out_10_17, out_10_18, out_10_19, out_11_0, out_11_1, out_11_2, out_11_3, out_11_4, out_11_5, out_11_6, out_11_7, out_11_8, out_11_9, out_11_10, out_11_11, out_11_12, out_11_13, out_11_14, out_11_15, out_11_16, out_11_17, out_11_18, out_11_19, out_12_0, out_12_1, out_12_2, out_12_3, out_12_4, out_12_5, out_12_6, out_12_7, out_12_8, out_12_9, out_12_10, out_12_11, out_12_12, out_12_13, out_12_14, out_12_15, out_12_16, out_12_17, out_12_18, out_12_19, out_13_0, out_13_1, out_13_2, out_13_3, out_13_4, out_13_5, out_13_6, out_13_7, out_13_8, out_13_9, out_13_10, out_13_11, out_13_12, out_13_13, out_13_14, out_13_15, out_13_16, out_13_17, out_13_18, out_13_19, out_14_0, out_14_1, out_14_2, out_14_3, out_14_4, out_14_5, out_14_6, out_14_7, out_14_8, out_14_9, out_14_10, out_14_11, out_14_12, out_14_13, out_14_14, out_14_15, out_14_16, out_14_17, out_14_18, out_14_19, out_15_0, out_15_1, out_15_2, out_15_3, out_15_4, out_15_5, out_15_6, out_15_7, out_15_8, out_15_9, out_15_10, out_15_11, out_15_12, out_15_13, out_15_14, out_15_15, out_15_16, out_15_17, out_15_18, out_15_19, out_16_0, out_16_1, out_16_2, out_16_3, out_16_4, out_16_5, out_16_6, out_16_7, out_16_8, out_16_9, out_16_10, out_16_11, out_16_12, out_16_13, out_16_14, out_16_15, out_16_16, out_16_17, out_16_18, out_16_19, out_17_0, out_17_1, out_17_2, out_17_3, out_17_4, out_17_5, out_17_6, out_17_7, out_17_8, out_17_9, out_17_10, out_17_11, out_17_12, out_17_13, out_17_14, out_17_15, out_17_16, out_17_17, out_17_18, out_17_19, out_18_0, out_18_1, out_18_2, out_18_3, out_18_4, out_18_5, out_18_6, out_18_7, out_18_8, out_18_9, out_18_10, out_18_11, out_18_12, out_18_13, out_18_14, out_18_15, out_18_16, out_18_17, out_18_18, out_18_19, out_19_0, out_19_1, out_19_2, out_19_3, out_19_4, out_19_5, out_19_6, out_19_7, out_19_8, out_19_9, out_19_10, out_19_11, out_19_12, out_19_13, out_19_14, out_19_15, out_19_16, out_19_17, out_19_18, out_19_19;
+    return out_JF_x;
+  }
+  // Evaluate the Jacobian of F with respect to x_dot.
+  MatrixJF JF_x_dot(VectorF const & in_0, VectorF const & /*in_1*/, Real /*in_2*/) const override
+  {
+    // Create data' aliases
+    Real const & m1 = this->m_m1; // Data variable 1
+    Real const & m2 = this->m_m2; // Data variable 2
+    Real const & m3 = this->m_m3; // Data variable 3
+    Real const & m4 = this->m_m4; // Data variable 4
+    Real const & m5 = this->m_m5; // Data variable 5
+    Real const & m6 = this->m_m6; // Data variable 6
+    Real const & m7 = this->m_m7; // Data variable 7
+    Real const & I1 = this->m_I1; // Data variable 15
+    Real const & I2 = this->m_I2; // Data variable 16
+    Real const & I3 = this->m_I3; // Data variable 17
+    Real const & I4 = this->m_I4; // Data variable 18
+    Real const & I5 = this->m_I5; // Data variable 19
+    Real const & I6 = this->m_I6; // Data variable 20
+    Real const & I7 = this->m_I7; // Data variable 21
+    Real const & d = this->m_d; // Data variable 22
+    Real const & da = this->m_da; // Data variable 23
+    Real const & e = this->m_e; // Data variable 24
+    Real const & ea = this->m_ea; // Data variable 25
+    Real const & rr = this->m_rr; // Data variable 26
+    Real const & ra = this->m_ra; // Data variable 27
+    Real const & ss = this->m_ss; // Data variable 29
+    Real const & sa = this->m_sa; // Data variable 30
+    Real const & sb = this->m_sb; // Data variable 31
+    Real const & ta = this->m_ta; // Data variable 34
+    Real const & tb = this->m_tb; // Data variable 35
+    Real const & u = this->m_u; // Data variable 36
+    Real const & ua = this->m_ua; // Data variable 37
+    Real const & ub = this->m_ub; // Data variable 38
+    Real const & zf = this->m_zf; // Data variable 39
+    Real const & zt = this->m_zt; // Data variable 40
+    Real const & fa = this->m_fa; // Data variable 41
+
+    // Create inputs' aliases
+    Real const & y_1 = in_0(0); // State variable 1
+    Real const & y_2 = in_0(1); // State variable 2
+    Real const & y_3 = in_0(2); // State variable 3
+    Real const & y_4 = in_0(3); // State variable 4
+    Real const & y_5 = in_0(4); // State variable 5
+    Real const & y_6 = in_0(5); // State variable 6
+    Real const & y_7 = in_0(6); // State variable 7
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real t1 = da * da;
+    Real t2 = rr * cos(y_2);
+    Real t3 = I2 + da * m2 * (da - t2);
+    Real t4 = e - ea;
+    Real t5 = t4 * t4;
+    Real t6 = zt * sin(y_4);
+    Real t7 = I4 + m4 * t4 * (t4 + t6);
+    Real t8 = fa - zf;
+    Real t9 = t8 * t8;
+    Real t10 = u * sin(y_6);
+    Real t11 = I6 + m6 * t8 * (t10 + t8);
+    Real t12 = y_1 + y_2;
+    Real t13 = d * sin(t12);
+    Real t14 = -rr * sin(y_1) + t13;
+    Real t15 = d * cos(t12);
+    Real t16 = rr * cos(y_1) - t15;
+    Real t17 = -t15;
+    Real t18 = y_4 + y_5;
+    Real t19 = e * cos(t18);
+    Real t20 = e * sin(t18);
+    Real t21 = y_6 + y_7;
+    Real t22 = sin(t21);
+    Real t23 = zf * cos(t21);
+    Real out_0_0 = 1;
+    Real out_0_1 = 0;
+    Real out_0_2 = 0;
+    Real out_0_3 = 0;
+    Real out_0_4 = 0;
+    Real out_0_5 = 0;
+    Real out_0_6 = 0;
+    Real out_0_7 = 0;
+    Real out_0_8 = 0;
+    Real out_0_9 = 0;
+    Real out_0_10 = 0;
+    Real out_0_11 = 0;
+    Real out_0_12 = 0;
+    Real out_0_13 = 0;
+    Real out_0_14 = 0;
+    Real out_0_15 = 0;
+    Real out_0_16 = 0;
+    Real out_0_17 = 0;
+    Real out_0_18 = 0;
+    Real out_0_19 = 0;
+    Real out_1_0 = 0;
+    Real out_1_1 = 1;
+    Real out_1_2 = 0;
+    Real out_1_3 = 0;
+    Real out_1_4 = 0;
+    Real out_1_5 = 0;
+    Real out_1_6 = 0;
+    Real out_1_7 = 0;
+    Real out_1_8 = 0;
+    Real out_1_9 = 0;
+    Real out_1_10 = 0;
+    Real out_1_11 = 0;
+    Real out_1_12 = 0;
+    Real out_1_13 = 0;
+    Real out_1_14 = 0;
+    Real out_1_15 = 0;
+    Real out_1_16 = 0;
+    Real out_1_17 = 0;
+    Real out_1_18 = 0;
+    Real out_1_19 = 0;
+    Real out_2_0 = 0;
+    Real out_2_1 = 0;
+    Real out_2_2 = 1;
+    Real out_2_3 = 0;
+    Real out_2_4 = 0;
+    Real out_2_5 = 0;
+    Real out_2_6 = 0;
+    Real out_2_7 = 0;
+    Real out_2_8 = 0;
+    Real out_2_9 = 0;
+    Real out_2_10 = 0;
+    Real out_2_11 = 0;
+    Real out_2_12 = 0;
+    Real out_2_13 = 0;
+    Real out_2_14 = 0;
+    Real out_2_15 = 0;
+    Real out_2_16 = 0;
+    Real out_2_17 = 0;
+    Real out_2_18 = 0;
+    Real out_2_19 = 0;
+    Real out_3_0 = 0;
+    Real out_3_1 = 0;
+    Real out_3_2 = 0;
+    Real out_3_3 = 1;
+    Real out_3_4 = 0;
+    Real out_3_5 = 0;
+    Real out_3_6 = 0;
+    Real out_3_7 = 0;
+    Real out_3_8 = 0;
+    Real out_3_9 = 0;
+    Real out_3_10 = 0;
+    Real out_3_11 = 0;
+    Real out_3_12 = 0;
+    Real out_3_13 = 0;
+    Real out_3_14 = 0;
+    Real out_3_15 = 0;
+    Real out_3_16 = 0;
+    Real out_3_17 = 0;
+    Real out_3_18 = 0;
+    Real out_3_19 = 0;
+    Real out_4_0 = 0;
+    Real out_4_1 = 0;
+    Real out_4_2 = 0;
+    Real out_4_3 = 0;
+    Real out_4_4 = 1;
+    Real out_4_5 = 0;
+    Real out_4_6 = 0;
+    Real out_4_7 = 0;
+    Real out_4_8 = 0;
+    Real out_4_9 = 0;
+    Real out_4_10 = 0;
+    Real out_4_11 = 0;
+    Real out_4_12 = 0;
+    Real out_4_13 = 0;
+    Real out_4_14 = 0;
+    Real out_4_15 = 0;
+    Real out_4_16 = 0;
+    Real out_4_17 = 0;
+    Real out_4_18 = 0;
+    Real out_4_19 = 0;
+    Real out_5_0 = 0;
+    Real out_5_1 = 0;
+    Real out_5_2 = 0;
+    Real out_5_3 = 0;
+    Real out_5_4 = 0;
+    Real out_5_5 = 1;
+    Real out_5_6 = 0;
+    Real out_5_7 = 0;
+    Real out_5_8 = 0;
+    Real out_5_9 = 0;
+    Real out_5_10 = 0;
+    Real out_5_11 = 0;
+    Real out_5_12 = 0;
+    Real out_5_13 = 0;
+    Real out_5_14 = 0;
+    Real out_5_15 = 0;
+    Real out_5_16 = 0;
+    Real out_5_17 = 0;
+    Real out_5_18 = 0;
+    Real out_5_19 = 0;
+    Real out_6_0 = 0;
+    Real out_6_1 = 0;
+    Real out_6_2 = 0;
+    Real out_6_3 = 0;
+    Real out_6_4 = 0;
+    Real out_6_5 = 0;
+    Real out_6_6 = 1;
+    Real out_6_7 = 0;
+    Real out_6_8 = 0;
+    Real out_6_9 = 0;
+    Real out_6_10 = 0;
+    Real out_6_11 = 0;
+    Real out_6_12 = 0;
+    Real out_6_13 = 0;
+    Real out_6_14 = 0;
+    Real out_6_15 = 0;
+    Real out_6_16 = 0;
+    Real out_6_17 = 0;
+    Real out_6_18 = 0;
+    Real out_6_19 = 0;
+    Real out_7_0 = 0;
+    Real out_7_1 = 0;
+    Real out_7_2 = 0;
+    Real out_7_3 = 0;
+    Real out_7_4 = 0;
+    Real out_7_5 = 0;
+    Real out_7_6 = 0;
+    Real out_7_7 = I1 + I2 + m1 * ra * ra + m2 * (-2 * da * t2 + rr * rr + t1);
+    Real out_7_8 = t3;
+    Real out_7_9 = 0;
+    Real out_7_10 = 0;
+    Real out_7_11 = 0;
+    Real out_7_12 = 0;
+    Real out_7_13 = 0;
+    Real out_7_14 = 0;
+    Real out_7_15 = 0;
+    Real out_7_16 = 0;
+    Real out_7_17 = 0;
+    Real out_7_18 = 0;
+    Real out_7_19 = 0;
+    Real out_8_0 = 0;
+    Real out_8_1 = 0;
+    Real out_8_2 = 0;
+    Real out_8_3 = 0;
+    Real out_8_4 = 0;
+    Real out_8_5 = 0;
+    Real out_8_6 = 0;
+    Real out_8_7 = t3;
+    Real out_8_8 = I2 + m2 * t1;
+    Real out_8_9 = 0;
+    Real out_8_10 = 0;
+    Real out_8_11 = 0;
+    Real out_8_12 = 0;
+    Real out_8_13 = 0;
+    Real out_8_14 = 0;
+    Real out_8_15 = 0;
+    Real out_8_16 = 0;
+    Real out_8_17 = 0;
+    Real out_8_18 = 0;
+    Real out_8_19 = 0;
+    Real out_9_0 = 0;
+    Real out_9_1 = 0;
+    Real out_9_2 = 0;
+    Real out_9_3 = 0;
+    Real out_9_4 = 0;
+    Real out_9_5 = 0;
+    Real out_9_6 = 0;
+    Real out_9_7 = 0;
+    Real out_9_8 = 0;
+    Real out_9_9 = I3 + m3 * (sa * sa + sb * sb);
+    Real out_9_10 = 0;
+    Real out_9_11 = 0;
+    Real out_9_12 = 0;
+    Real out_9_13 = 0;
+    Real out_9_14 = 0;
+    Real out_9_15 = 0;
+    Real out_9_16 = 0;
+    Real out_9_17 = 0;
+    Real out_9_18 = 0;
+    Real out_9_19 = 0;
+    Real out_10_0 = 0;
+    Real out_10_1 = 0;
+    Real out_10_2 = 0;
+    Real out_10_3 = 0;
+    Real out_10_4 = 0;
+    Real out_10_5 = 0;
+    Real out_10_6 = 0;
+    Real out_10_7 = 0;
+    Real out_10_8 = 0;
+    Real out_10_9 = 0;
+    Real out_10_10 = I4 + m4 * t5;
+    Real out_10_11 = t7;
+    Real out_10_12 = 0;
+    Real out_10_13 = 0;
+    Real out_10_14 = 0;
+    Real out_10_15 = 0;
+    Real out_10_16 = 0;
+    Real out_10_17 = 0;
+    Real out_10_18 = 0;
+    Real out_10_19 = 0;
+    Real out_11_0 = 0;
+    Real out_11_1 = 0;
+    Real out_11_2 = 0;
+    Real out_11_3 = 0;
+    Real out_11_4 = 0;
+    Real out_11_5 = 0;
+    Real out_11_6 = 0;
+    Real out_11_7 = 0;
+    Real out_11_8 = 0;
+    Real out_11_9 = 0;
+    Real out_11_10 = t7;
+    Real out_11_11 = I4 + I5 + m4 * (2 * t4 * t6 + t5 + zt * zt) + m5 * (ta * ta + tb * tb);
+    Real out_11_12 = 0;
+    Real out_11_13 = 0;
+    Real out_11_14 = 0;
+    Real out_11_15 = 0;
+    Real out_11_16 = 0;
+    Real out_11_17 = 0;
+    Real out_11_18 = 0;
+    Real out_11_19 = 0;
+    Real out_12_0 = 0;
+    Real out_12_1 = 0;
+    Real out_12_2 = 0;
+    Real out_12_3 = 0;
+    Real out_12_4 = 0;
+    Real out_12_5 = 0;
+    Real out_12_6 = 0;
+    Real out_12_7 = 0;
+    Real out_12_8 = 0;
+    Real out_12_9 = 0;
+    Real out_12_10 = 0;
+    Real out_12_11 = 0;
+    Real out_12_12 = I6 + m6 * t9;
+    Real out_12_13 = t11;
+    Real out_12_14 = 0;
+    Real out_12_15 = 0;
+    Real out_12_16 = 0;
+    Real out_12_17 = 0;
+    Real out_12_18 = 0;
+    Real out_12_19 = 0;
+    Real out_13_0 = 0;
+    Real out_13_1 = 0;
+    Real out_13_2 = 0;
+    Real out_13_3 = 0;
+    Real out_13_4 = 0;
+    Real out_13_5 = 0;
+    Real out_13_6 = 0;
+    Real out_13_7 = 0;
+    Real out_13_8 = 0;
+    Real out_13_9 = 0;
+    Real out_13_10 = 0;
+    Real out_13_11 = 0;
+    Real out_13_12 = t11;
+    Real out_13_13 = I6 + I7 + m6 * (2 * t10 * t8 + t9 + u * u) + m7 * (ua * ua + ub * ub);
+    Real out_13_14 = 0;
+    Real out_13_15 = 0;
+    Real out_13_16 = 0;
+    Real out_13_17 = 0;
+    Real out_13_18 = 0;
+    Real out_13_19 = 0;
+    Real out_14_0 = 0;
+    Real out_14_1 = 0;
+    Real out_14_2 = 0;
+    Real out_14_3 = 0;
+    Real out_14_4 = 0;
+    Real out_14_5 = 0;
+    Real out_14_6 = 0;
+    Real out_14_7 = t14;
+    Real out_14_8 = t13;
+    Real out_14_9 = -ss * cos(y_3);
+    Real out_14_10 = 0;
+    Real out_14_11 = 0;
+    Real out_14_12 = 0;
+    Real out_14_13 = 0;
+    Real out_14_14 = 0;
+    Real out_14_15 = 0;
+    Real out_14_16 = 0;
+    Real out_14_17 = 0;
+    Real out_14_18 = 0;
+    Real out_14_19 = 0;
+    Real out_15_0 = 0;
+    Real out_15_1 = 0;
+    Real out_15_2 = 0;
+    Real out_15_3 = 0;
+    Real out_15_4 = 0;
+    Real out_15_5 = 0;
+    Real out_15_6 = 0;
+    Real out_15_7 = t16;
+    Real out_15_8 = t17;
+    Real out_15_9 = -ss * sin(y_3);
+    Real out_15_10 = 0;
+    Real out_15_11 = 0;
+    Real out_15_12 = 0;
+    Real out_15_13 = 0;
+    Real out_15_14 = 0;
+    Real out_15_15 = 0;
+    Real out_15_16 = 0;
+    Real out_15_17 = 0;
+    Real out_15_18 = 0;
+    Real out_15_19 = 0;
+    Real out_16_0 = 0;
+    Real out_16_1 = 0;
+    Real out_16_2 = 0;
+    Real out_16_3 = 0;
+    Real out_16_4 = 0;
+    Real out_16_5 = 0;
+    Real out_16_6 = 0;
+    Real out_16_7 = t14;
+    Real out_16_8 = t13;
+    Real out_16_9 = 0;
+    Real out_16_10 = -t19;
+    Real out_16_11 = -t19 + zt * sin(y_5);
+    Real out_16_12 = 0;
+    Real out_16_13 = 0;
+    Real out_16_14 = 0;
+    Real out_16_15 = 0;
+    Real out_16_16 = 0;
+    Real out_16_17 = 0;
+    Real out_16_18 = 0;
+    Real out_16_19 = 0;
+    Real out_17_0 = 0;
+    Real out_17_1 = 0;
+    Real out_17_2 = 0;
+    Real out_17_3 = 0;
+    Real out_17_4 = 0;
+    Real out_17_5 = 0;
+    Real out_17_6 = 0;
+    Real out_17_7 = t16;
+    Real out_17_8 = t17;
+    Real out_17_9 = 0;
+    Real out_17_10 = -t20;
+    Real out_17_11 = -t20 - zt * cos(y_5);
+    Real out_17_12 = 0;
+    Real out_17_13 = 0;
+    Real out_17_14 = 0;
+    Real out_17_15 = 0;
+    Real out_17_16 = 0;
+    Real out_17_17 = 0;
+    Real out_17_18 = 0;
+    Real out_17_19 = 0;
+    Real out_18_0 = 0;
+    Real out_18_1 = 0;
+    Real out_18_2 = 0;
+    Real out_18_3 = 0;
+    Real out_18_4 = 0;
+    Real out_18_5 = 0;
+    Real out_18_6 = 0;
+    Real out_18_7 = t14;
+    Real out_18_8 = t13;
+    Real out_18_9 = 0;
+    Real out_18_10 = 0;
+    Real out_18_11 = 0;
+    Real out_18_12 = t22 * zf;
+    Real out_18_13 = t22 * zf - u * cos(y_7);
+    Real out_18_14 = 0;
+    Real out_18_15 = 0;
+    Real out_18_16 = 0;
+    Real out_18_17 = 0;
+    Real out_18_18 = 0;
+    Real out_18_19 = 0;
+    Real out_19_0 = 0;
+    Real out_19_1 = 0;
+    Real out_19_2 = 0;
+    Real out_19_3 = 0;
+    Real out_19_4 = 0;
+    Real out_19_5 = 0;
+    Real out_19_6 = 0;
+    Real out_19_7 = t16;
+    Real out_19_8 = t17;
+    Real out_19_9 = 0;
+    Real out_19_10 = 0;
+    Real out_19_11 = 0;
+    Real out_19_12 = -t23;
+    Real out_19_13 = -t23 - u * sin(y_7);
+    Real out_19_14 = 0;
+    Real out_19_15 = 0;
+    Real out_19_16 = 0;
+    Real out_19_17 = 0;
+    Real out_19_18 = 0;
+    Real out_19_19 = 0;
+
+    // Return results
+    MatrixJF out_JF_x_dot;
+    out_JF_x_dot <<
+      out_0_0, out_0_1, out_0_2, out_0_3, out_0_4, out_0_5, out_0_6, out_0_7, out_0_8, out_0_9, out_0_10, out_0_11, out_0_12, out_0_13, out_0_14, out_0_15, out_0_16, out_0_17, out_0_18, out_0_19, out_1_0, out_1_1, out_1_2, out_1_3, out_1_4, out_1_5, out_1_6, out_1_7, out_1_8, out_1_9, out_1_10, out_1_11, out_1_12, out_1_13, out_1_14, out_1_15, out_1_16, out_1_17, out_1_18, out_1_19, out_2_0, out_2_1, out_2_2, out_2_3, out_2_4, out_2_5, out_2_6, out_2_7, out_2_8, out_2_9, out_2_10, out_2_11, out_2_12, out_2_13, out_2_14, out_2_15, out_2_16, out_2_17, out_2_18, out_2_19, out_3_0, out_3_1, out_3_2, out_3_3, out_3_4, out_3_5, out_3_6, out_3_7, out_3_8, out_3_9, out_3_10, out_3_11, out_3_12, out_3_13, out_3_14, out_3_15, out_3_16, out_3_17, out_3_18, out_3_19, out_4_0, out_4_1, out_4_2, out_4_3, out_4_4, out_4_5, out_4_6, out_4_7, out_4_8, out_4_9, out_4_10, out_4_11, out_4_12, out_4_13, out_4_14, out_4_15, out_4_16, out_4_17, out_4_18, out_4_19, out_5_0, out_5_1, out_5_2, out_5_3, out_5_4, out_5_5, out_5_6, out_5_7, out_5_8, out_5_9, out_5_10, out_5_11, out_5_12, out_5_13, out_5_14, out_5_15, out_5_16, out_5_17, out_5_18, out_5_19, out_6_0, out_6_1, out_6_2, out_6_3, out_6_4, out_6_5, out_6_6, out_6_7, out_6_8, out_6_9, out_6_10, out_6_11, out_6_12, out_6_13, out_6_14, out_6_15, out_6_16, out_6_17, out_6_18, out_6_19, out_7_0, out_7_1, out_7_2, out_7_3, out_7_4, out_7_5, out_7_6, out_7_7, out_7_8, out_7_9, out_7_10, out_7_11, out_7_12, out_7_13, out_7_14, out_7_15, out_7_16, out_7_17, out_7_18, out_7_19, out_8_0, out_8_1, out_8_2, out_8_3, out_8_4, out_8_5, out_8_6, out_8_7, out_8_8, out_8_9, out_8_10, out_8_11, out_8_12, out_8_13, out_8_14, out_8_15, out_8_16, out_8_17, out_8_18, out_8_19, out_9_0, out_9_1, out_9_2, out_9_3, out_9_4, out_9_5, out_9_6, out_9_7, out_9_8, out_9_9, out_9_10, out_9_11, out_9_12, out_9_13, out_9_14, out_9_15, out_9_16, out_9_17, out_9_18, out_9_19, out_10_0, out_10_1, out_10_2, out_10_3, out_10_4, out_10_5, out_10_6, out_10_7, out_10_8, out_10_9, out_10_10, out_10_11, out_10_12, out_10_13, out_10_14, out_10_15, out_10_16, out_10_17, out_10_18, out_10_19, out_11_0, out_11_1, out_11_2, out_11_3, out_11_4, out_11_5, out_11_6, out_11_7, out_11_8, out_11_9, out_11_10, out_11_11, out_11_12, out_11_13, out_11_14, out_11_15, out_11_16, out_11_17, out_11_18, out_11_19, out_12_0, out_12_1, out_12_2, out_12_3, out_12_4, out_12_5, out_12_6, out_12_7, out_12_8, out_12_9, out_12_10, out_12_11, out_12_12, out_12_13, out_12_14, out_12_15, out_12_16, out_12_17, out_12_18, out_12_19, out_13_0, out_13_1, out_13_2, out_13_3, out_13_4, out_13_5, out_13_6, out_13_7, out_13_8, out_13_9, out_13_10, out_13_11, out_13_12, out_13_13, out_13_14, out_13_15, out_13_16, out_13_17, out_13_18, out_13_19, out_14_0, out_14_1, out_14_2, out_14_3, out_14_4, out_14_5, out_14_6, out_14_7, out_14_8, out_14_9, out_14_10, out_14_11, out_14_12, out_14_13, out_14_14, out_14_15, out_14_16, out_14_17, out_14_18, out_14_19, out_15_0, out_15_1, out_15_2, out_15_3, out_15_4, out_15_5, out_15_6, out_15_7, out_15_8, out_15_9, out_15_10, out_15_11, out_15_12, out_15_13, out_15_14, out_15_15, out_15_16, out_15_17, out_15_18, out_15_19, out_16_0, out_16_1, out_16_2, out_16_3, out_16_4, out_16_5, out_16_6, out_16_7, out_16_8, out_16_9, out_16_10, out_16_11, out_16_12, out_16_13, out_16_14, out_16_15, out_16_16, out_16_17, out_16_18, out_16_19, out_17_0, out_17_1, out_17_2, out_17_3, out_17_4, out_17_5, out_17_6, out_17_7, out_17_8, out_17_9, out_17_10, out_17_11, out_17_12, out_17_13, out_17_14, out_17_15, out_17_16, out_17_17, out_17_18, out_17_19, out_18_0, out_18_1, out_18_2, out_18_3, out_18_4, out_18_5, out_18_6, out_18_7, out_18_8, out_18_9, out_18_10, out_18_11, out_18_12, out_18_13, out_18_14, out_18_15, out_18_16, out_18_17, out_18_18, out_18_19, out_19_0, out_19_1, out_19_2, out_19_3, out_19_4, out_19_5, out_19_6, out_19_7, out_19_8, out_19_9, out_19_10, out_19_11, out_19_12, out_19_13, out_19_14, out_19_15, out_19_16, out_19_17, out_19_18, out_19_19;
+    return out_JF_x_dot;
+  }
+
+  // Calculate the vector h of the invariants.
+  VectorH h(VectorF const & /*in_0*/, Real /*in_1*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    // Nothing to evaluate
+
+    // Return results
+    VectorH out_h;
+    out_h.setZero();
+    return out_h;
+  }
+
+  // Calculate the Jacobian of h with respect to x.
+  MatrixJH Jh_x(VectorF const & /*in_0*/, Real /*in_1*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    // Nothing to evaluate
+
+    // Return results
+    MatrixJH out_Jh_x;
+    out_Jh_x.setZero();
+    return out_Jh_x;
+  }
+
+  // Check if the system is in the defined domain.
+  bool in_domain(VectorF const &/*x*/, Real /*t*/) const override {return true;}
+
+  // Return the initial integration time
+  Real t_ini() const {return 0.;}
+
+  // Return the final integration time
+  Real t_end() const {return 0.3e-1;}
+
+  // Evaluate the initial conditions.
+  VectorF ics() const
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0 = -0.6171389001427645e-1;
+    Real out_1 = 0.0e0;
+    Real out_2 = 0.45527981916307037e0;
+    Real out_3 = 0.22266839016588588e0;
+    Real out_4 = 0.48736497954384256e0;
+    Real out_5 = -0.22266839016588588e0;
+    Real out_6 = 0.12305474445498212e1;
+    Real out_7 = 0.0e0;
+    Real out_8 = 0.0e0;
+    Real out_9 = 0.0e0;
+    Real out_10 = 0.0e0;
+    Real out_11 = 0.0e0;
+    Real out_12 = 0.0e0;
+    Real out_13 = 0.0e0;
+    Real out_14 = 0.9856687039624109e2;
+    Real out_15 = -0.6122688344255662e1;
+    Real out_16 = 0.0e0;
+    Real out_17 = 0.0e0;
+    Real out_18 = 0.0e0;
+    Real out_19 = 0.0e0;
+
+    // Return results
+    VectorF out_ics;
+    out_ics <<
+      out_0, out_1, out_2, out_3, out_4, out_5, out_6, out_7, out_8, out_9, out_10, out_11, out_12, out_13, out_14, out_15, out_16, out_17, out_18, out_19;
+    return out_ics;
+  }
+
+}; // class Andrews
+
+#endif // SANDALS_MAPLE_ANDREWS_IMPLICIT_HH
@@ -0,0 +1,566 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// C++ generated code for implicit system: CarAxis
+// This file has been automatically generated by Sandals.
+// DISCLAIMER: If you need to edit it, do it wisely!
+
+#ifndef SANDALS_MAPLE_CARAXIS_IMPLICIT_HH
+#define SANDALS_MAPLE_CARAXIS_IMPLICIT_HH
+
+using namespace Sandals;
+using namespace std;
+
+// No class description available.
+template<typename Real = double>
+class CarAxis : public Implicit<Real, 10, 0>
+{
+  // Class data
+  Real m_epsilon{.01}; // Data variable 1
+  Real m_M{10.0}; // Data variable 2
+  Real m_L{1.0}; // Data variable 3
+  Real m_L_0{.5}; // Data variable 4
+  Real m_r{.1}; // Data variable 5
+  Real m_w{10.0}; // Data variable 6
+  Real m_g{1.0}; // Data variable 7
+
+public:
+  using VectorF  = typename Implicit<Real, 10, 0>::VectorF;
+  using MatrixJF = typename Implicit<Real, 10, 0>::MatrixJF;
+  using VectorH  = typename Implicit<Real, 10, 0>::VectorH;
+  using MatrixJH = typename Implicit<Real, 10, 0>::MatrixJH;
+
+  // Class constructor.
+  CarAxis() : Implicit<Real, 10, 0>("CarAxis") {}
+
+  // Data variable 1 getter.
+  Real get_epsilon() const {return this->m_epsilon;}
+
+  // Data variable 1 setter.
+  void set_epsilon(Real t_epsilon) {this->m_epsilon = t_epsilon;}
+
+  // Data variable 2 getter.
+  Real get_M() const {return this->m_M;}
+
+  // Data variable 2 setter.
+  void set_M(Real t_M) {this->m_M = t_M;}
+
+  // Data variable 3 getter.
+  Real get_L() const {return this->m_L;}
+
+  // Data variable 3 setter.
+  void set_L(Real t_L) {this->m_L = t_L;}
+
+  // Data variable 4 getter.
+  Real get_L_0() const {return this->m_L_0;}
+
+  // Data variable 4 setter.
+  void set_L_0(Real t_L_0) {this->m_L_0 = t_L_0;}
+
+  // Data variable 5 getter.
+  Real get_r() const {return this->m_r;}
+
+  // Data variable 5 setter.
+  void set_r(Real t_r) {this->m_r = t_r;}
+
+  // Data variable 6 getter.
+  Real get_w() const {return this->m_w;}
+
+  // Data variable 6 setter.
+  void set_w(Real t_w) {this->m_w = t_w;}
+
+  // Data variable 7 getter.
+  Real get_g() const {return this->m_g;}
+
+  // Data variable 7 setter.
+  void set_g(Real t_g) {this->m_g = t_g;}
+
+  // Evaluate the function F.
+  VectorF F(VectorF const & in_0, VectorF const & in_1, Real in_2) const override
+  {
+    // Create data' aliases
+    Real const & epsilon = this->m_epsilon; // Data variable 1
+    Real const & M = this->m_M; // Data variable 2
+    Real const & L = this->m_L; // Data variable 3
+    Real const & L_0 = this->m_L_0; // Data variable 4
+    Real const & r = this->m_r; // Data variable 5
+    Real const & w = this->m_w; // Data variable 6
+    Real const & g = this->m_g; // Data variable 7
+
+    // Create inputs' aliases
+    Real const & y_1 = in_0(0); // State variable 1
+    Real const & y_2 = in_0(1); // State variable 2
+    Real const & y_3 = in_0(2); // State variable 3
+    Real const & y_4 = in_0(3); // State variable 4
+    Real const & y_5 = in_0(4); // State variable 5
+    Real const & y_6 = in_0(5); // State variable 6
+    Real const & y_7 = in_0(6); // State variable 7
+    Real const & y_8 = in_0(7); // State variable 8
+    Real const & y_9 = in_0(8); // State variable 9
+    Real const & y_10 = in_0(9); // State variable 10
+    Real const & y_1_dot = in_1(0); // State variable 1 derivative
+    Real const & y_2_dot = in_1(1); // State variable 2 derivative
+    Real const & y_3_dot = in_1(2); // State variable 3 derivative
+    Real const & y_4_dot = in_1(3); // State variable 4 derivative
+    Real const & y_5_dot = in_1(4); // State variable 5 derivative
+    Real const & y_6_dot = in_1(5); // State variable 6 derivative
+    Real const & y_7_dot = in_1(6); // State variable 7 derivative
+    Real const & y_8_dot = in_1(7); // State variable 8 derivative
+    Real const & t = in_2; // Independent variable
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real t1 = -y_7;
+    Real t2 = -y_8;
+    Real t3 = epsilon * epsilon;
+    Real t4 = y_1 - y_3;
+    Real t5 = 2 * y_10;
+    Real t6 = t4 * t5;
+    Real t7 = r * r;
+    Real t8 = t * w;
+    Real t9 = sin(t8);
+    Real t10 = t9 * t9;
+    Real t11 = L * L - t10 * t7;
+    Real t12 = sqrt(t11);
+    Real t13 = sqrt(y_1 * y_1 + y_2 * y_2);
+    Real t14 = (L_0 - t13) / t13;
+    Real t15 = r * t9;
+    Real t16 = -y_4;
+    Real t17 = t16 + y_2;
+    Real t18 = t17 * t5;
+    Real t19 = M * t3 / 2;
+    Real t20 = -t12 + y_3;
+    Real t21 = t15 + t16;
+    Real t22 = sqrt(t20 * t20 + t21 * t21);
+    Real t23 = (L_0 - t22) / t22;
+    Real t24 = cos(t8);
+    Real t25 = 2 * t24 * w;
+    Real t26 = 0.1e1 / t12;
+    Real t27 = t24 * t24 * y_1;
+    Real t28 = r * t26;
+    Real t29 = t1 + y_5;
+    Real t30 = t2 + y_6;
+    Real out_0 = y_1_dot - y_5;
+    Real out_1 = y_2_dot - y_6;
+    Real out_2 = t1 + y_3_dot;
+    Real out_3 = t2 + y_4_dot;
+    Real out_4 = M * t3 * y_5_dot / 2 - t12 * y_9 - t14 * y_1 - t6;
+    Real out_5 = M * g * t3 / 2 + M * t3 * y_6_dot / 2 - t14 * y_2 - t15 * y_9 - t18;
+    Real out_6 = t19 * y_7_dot - t20 * t23 + t6;
+    Real out_7 = g * t19 + t18 + t19 * y_8_dot + t21 * t23;
+    Real out_8 = r * t25 * y_6 - r * w * w * (r * r * r * t10 * t27 / pow(t11, 0.3e1 / 0.2e1) - t10 * t28 * y_1 + t27 * t28 + t9 * y_2) + t12 * y_5_dot + t15 * y_6_dot - t25 * t26 * t7 * t9 * y_5;
+    Real out_9 = 2 * t17 * y_6_dot - 2 * t17 * y_8_dot + 2 * t29 * y_5 - 2 * t29 * y_7 + 2 * t30 * y_6 - 2 * t30 * y_8 + 2 * t4 * y_5_dot - 2 * t4 * y_7_dot;
+
+    // Return results
+    VectorF out_F;
+    out_F <<
+      out_0, out_1, out_2, out_3, out_4, out_5, out_6, out_7, out_8, out_9;
+    return out_F;
+  }
+
+  // Evaluate the Jacobian of F with respect to x.
+  MatrixJF JF_x(VectorF const & in_0, VectorF const & in_1, Real in_2) const override
+  {
+    // Create data' aliases
+    Real const & L = this->m_L; // Data variable 3
+    Real const & L_0 = this->m_L_0; // Data variable 4
+    Real const & r = this->m_r; // Data variable 5
+    Real const & w = this->m_w; // Data variable 6
+
+    // Create inputs' aliases
+    Real const & y_1 = in_0(0); // State variable 1
+    Real const & y_2 = in_0(1); // State variable 2
+    Real const & y_3 = in_0(2); // State variable 3
+    Real const & y_4 = in_0(3); // State variable 4
+    Real const & y_5 = in_0(4); // State variable 5
+    Real const & y_6 = in_0(5); // State variable 6
+    Real const & y_7 = in_0(6); // State variable 7
+    Real const & y_8 = in_0(7); // State variable 8
+    Real const & y_10 = in_0(9); // State variable 10
+    Real const & y_5_dot = in_1(4); // State variable 5 derivative
+    Real const & y_6_dot = in_1(5); // State variable 6 derivative
+    Real const & y_7_dot = in_1(6); // State variable 7 derivative
+    Real const & y_8_dot = in_1(7); // State variable 8 derivative
+    Real const & t = in_2; // Independent variable
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real t1 = 2 * y_10;
+    Real t2 = y_1 * y_1;
+    Real t3 = y_2 * y_2;
+    Real t4 = t2 + t3;
+    Real t5 = 0.1e1 / t4;
+    Real t6 = sqrt(t4);
+    Real t7 = L_0 - t6;
+    Real t8 = t7 / t6;
+    Real t9 = pow(t4, -0.3e1 / 0.2e1);
+    Real t10 = t7 * t9;
+    Real t11 = y_1 * y_2 * (t10 + t5);
+    Real t12 = r * r;
+    Real t13 = t * w;
+    Real t14 = sin(t13);
+    Real t15 = t14 * t14;
+    Real t16 = t12 * t15;
+    Real t17 = L * L - t16;
+    Real t18 = sqrt(t17);
+    Real t19 = -t18;
+    Real t20 = y_1 - y_3;
+    Real t21 = r * t14;
+    Real t22 = -y_4;
+    Real t23 = t22 + y_2;
+    Real t24 = t19 + y_3;
+    Real t25 = t24 * t24;
+    Real t26 = t21 + t22;
+    Real t27 = t26 * t26;
+    Real t28 = t25 + t27;
+    Real t29 = 0.1e1 / t28;
+    Real t30 = pow(t28, -0.3e1 / 0.2e1);
+    Real t31 = sqrt(t28);
+    Real t32 = L_0 - t31;
+    Real t33 = t1 + t32 / t31;
+    Real t34 = -t24 * t26 * (t29 + t30 * t32);
+    Real t35 = w * w;
+    Real t36 = cos(t13);
+    Real t37 = t36 * t36;
+    Real t38 = t12 / t18;
+    Real t39 = 2 * t36 * w;
+    Real t40 = y_5_dot - y_7_dot;
+    Real t41 = y_6_dot - y_8_dot;
+    Real t42 = y_5 - y_7;
+    Real t43 = y_6 - y_8;
+    Real out_0_0 = 0;
+    Real out_0_1 = 0;
+    Real out_0_2 = 0;
+    Real out_0_3 = 0;
+    Real out_0_4 = -1;
+    Real out_0_5 = 0;
+    Real out_0_6 = 0;
+    Real out_0_7 = 0;
+    Real out_0_8 = 0;
+    Real out_0_9 = 0;
+    Real out_1_0 = 0;
+    Real out_1_1 = 0;
+    Real out_1_2 = 0;
+    Real out_1_3 = 0;
+    Real out_1_4 = 0;
+    Real out_1_5 = -1;
+    Real out_1_6 = 0;
+    Real out_1_7 = 0;
+    Real out_1_8 = 0;
+    Real out_1_9 = 0;
+    Real out_2_0 = 0;
+    Real out_2_1 = 0;
+    Real out_2_2 = 0;
+    Real out_2_3 = 0;
+    Real out_2_4 = 0;
+    Real out_2_5 = 0;
+    Real out_2_6 = -1;
+    Real out_2_7 = 0;
+    Real out_2_8 = 0;
+    Real out_2_9 = 0;
+    Real out_3_0 = 0;
+    Real out_3_1 = 0;
+    Real out_3_2 = 0;
+    Real out_3_3 = 0;
+    Real out_3_4 = 0;
+    Real out_3_5 = 0;
+    Real out_3_6 = 0;
+    Real out_3_7 = -1;
+    Real out_3_8 = 0;
+    Real out_3_9 = 0;
+    Real out_4_0 = -t1 + t10 * t2 + t2 * t5 - t8;
+    Real out_4_1 = t11;
+    Real out_4_2 = t1;
+    Real out_4_3 = 0;
+    Real out_4_4 = 0;
+    Real out_4_5 = 0;
+    Real out_4_6 = 0;
+    Real out_4_7 = 0;
+    Real out_4_8 = t19;
+    Real out_4_9 = -2 * t20;
+    Real out_5_0 = t11;
+    Real out_5_1 = -t1 + t3 * t5 + t3 * t7 * t9 - t8;
+    Real out_5_2 = 0;
+    Real out_5_3 = t1;
+    Real out_5_4 = 0;
+    Real out_5_5 = 0;
+    Real out_5_6 = 0;
+    Real out_5_7 = 0;
+    Real out_5_8 = -t21;
+    Real out_5_9 = -2 * t23;
+    Real out_6_0 = t1;
+    Real out_6_1 = 0;
+    Real out_6_2 = t25 * t29 + t25 * t30 * t32 - t33;
+    Real out_6_3 = t34;
+    Real out_6_4 = 0;
+    Real out_6_5 = 0;
+    Real out_6_6 = 0;
+    Real out_6_7 = 0;
+    Real out_6_8 = 0;
+    Real out_6_9 = 2 * t20;
+    Real out_7_0 = 0;
+    Real out_7_1 = t1;
+    Real out_7_2 = t34;
+    Real out_7_3 = t27 * t29 + t27 * t30 * t32 - t33;
+    Real out_7_4 = 0;
+    Real out_7_5 = 0;
+    Real out_7_6 = 0;
+    Real out_7_7 = 0;
+    Real out_7_8 = 0;
+    Real out_7_9 = 2 * t23;
+    Real out_8_0 = -t35 * t38 * (-t15 + t16 * t37 / t17 + t37);
+    Real out_8_1 = -t21 * t35;
+    Real out_8_2 = 0;
+    Real out_8_3 = 0;
+    Real out_8_4 = -t14 * t38 * t39;
+    Real out_8_5 = r * t39;
+    Real out_8_6 = 0;
+    Real out_8_7 = 0;
+    Real out_8_8 = 0;
+    Real out_8_9 = 0;
+    Real out_9_0 = 2 * t40;
+    Real out_9_1 = 2 * t41;
+    Real out_9_2 = -2 * t40;
+    Real out_9_3 = -2 * t41;
+    Real out_9_4 = 4 * t42;
+    Real out_9_5 = 4 * t43;
+    Real out_9_6 = -4 * t42;
+    Real out_9_7 = -4 * t43;
+    Real out_9_8 = 0;
+    Real out_9_9 = 0;
+
+    // Return results
+    MatrixJF out_JF_x;
+    out_JF_x <<
+      out_0_0, out_0_1, out_0_2, out_0_3, out_0_4, out_0_5, out_0_6, out_0_7, out_0_8, out_0_9, out_1_0, out_1_1, out_1_2, out_1_3, out_1_4, out_1_5, out_1_6, out_1_7, out_1_8, out_1_9, out_2_0, out_2_1, out_2_2, out_2_3, out_2_4, out_2_5, out_2_6, out_2_7, out_2_8, out_2_9, out_3_0, out_3_1, out_3_2, out_3_3, out_3_4, out_3_5, out_3_6, out_3_7, out_3_8, out_3_9, out_4_0, out_4_1, out_4_2, out_4_3, out_4_4, out_4_5, out_4_6, out_4_7, out_4_8, out_4_9, out_5_0, out_5_1, out_5_2, out_5_3, out_5_4, out_5_5, out_5_6, out_5_7, out_5_8, out_5_9, out_6_0, out_6_1, out_6_2, out_6_3, out_6_4, out_6_5, out_6_6, out_6_7, out_6_8, out_6_9, out_7_0, out_7_1, out_7_2, out_7_3, out_7_4, out_7_5, out_7_6, out_7_7, out_7_8, out_7_9, out_8_0, out_8_1, out_8_2, out_8_3, out_8_4, out_8_5, out_8_6, out_8_7, out_8_8, out_8_9, out_9_0, out_9_1, out_9_2, out_9_3, out_9_4, out_9_5, out_9_6, out_9_7, out_9_8, out_9_9;
+    return out_JF_x;
+  }
+  // Evaluate the Jacobian of F with respect to x_dot.
+  MatrixJF JF_x_dot(VectorF const & in_0, VectorF const & /*in_1*/, Real in_2) const override
+  {
+    // Create data' aliases
+    Real const & epsilon = this->m_epsilon; // Data variable 1
+    Real const & M = this->m_M; // Data variable 2
+    Real const & L = this->m_L; // Data variable 3
+    Real const & r = this->m_r; // Data variable 5
+    Real const & w = this->m_w; // Data variable 6
+
+    // Create inputs' aliases
+    Real const & y_1 = in_0(0); // State variable 1
+    Real const & y_2 = in_0(1); // State variable 2
+    Real const & y_3 = in_0(2); // State variable 3
+    Real const & y_4 = in_0(3); // State variable 4
+    Real const & t = in_2; // Independent variable
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real t1 = M * epsilon * epsilon / 2;
+    Real t2 = sin(t * w);
+    Real t3 = y_1 - y_3;
+    Real t4 = y_2 - y_4;
+    Real out_0_0 = 1;
+    Real out_0_1 = 0;
+    Real out_0_2 = 0;
+    Real out_0_3 = 0;
+    Real out_0_4 = 0;
+    Real out_0_5 = 0;
+    Real out_0_6 = 0;
+    Real out_0_7 = 0;
+    Real out_0_8 = 0;
+    Real out_0_9 = 0;
+    Real out_1_0 = 0;
+    Real out_1_1 = 1;
+    Real out_1_2 = 0;
+    Real out_1_3 = 0;
+    Real out_1_4 = 0;
+    Real out_1_5 = 0;
+    Real out_1_6 = 0;
+    Real out_1_7 = 0;
+    Real out_1_8 = 0;
+    Real out_1_9 = 0;
+    Real out_2_0 = 0;
+    Real out_2_1 = 0;
+    Real out_2_2 = 1;
+    Real out_2_3 = 0;
+    Real out_2_4 = 0;
+    Real out_2_5 = 0;
+    Real out_2_6 = 0;
+    Real out_2_7 = 0;
+    Real out_2_8 = 0;
+    Real out_2_9 = 0;
+    Real out_3_0 = 0;
+    Real out_3_1 = 0;
+    Real out_3_2 = 0;
+    Real out_3_3 = 1;
+    Real out_3_4 = 0;
+    Real out_3_5 = 0;
+    Real out_3_6 = 0;
+    Real out_3_7 = 0;
+    Real out_3_8 = 0;
+    Real out_3_9 = 0;
+    Real out_4_0 = 0;
+    Real out_4_1 = 0;
+    Real out_4_2 = 0;
+    Real out_4_3 = 0;
+    Real out_4_4 = t1;
+    Real out_4_5 = 0;
+    Real out_4_6 = 0;
+    Real out_4_7 = 0;
+    Real out_4_8 = 0;
+    Real out_4_9 = 0;
+    Real out_5_0 = 0;
+    Real out_5_1 = 0;
+    Real out_5_2 = 0;
+    Real out_5_3 = 0;
+    Real out_5_4 = 0;
+    Real out_5_5 = t1;
+    Real out_5_6 = 0;
+    Real out_5_7 = 0;
+    Real out_5_8 = 0;
+    Real out_5_9 = 0;
+    Real out_6_0 = 0;
+    Real out_6_1 = 0;
+    Real out_6_2 = 0;
+    Real out_6_3 = 0;
+    Real out_6_4 = 0;
+    Real out_6_5 = 0;
+    Real out_6_6 = t1;
+    Real out_6_7 = 0;
+    Real out_6_8 = 0;
+    Real out_6_9 = 0;
+    Real out_7_0 = 0;
+    Real out_7_1 = 0;
+    Real out_7_2 = 0;
+    Real out_7_3 = 0;
+    Real out_7_4 = 0;
+    Real out_7_5 = 0;
+    Real out_7_6 = 0;
+    Real out_7_7 = t1;
+    Real out_7_8 = 0;
+    Real out_7_9 = 0;
+    Real out_8_0 = 0;
+    Real out_8_1 = 0;
+    Real out_8_2 = 0;
+    Real out_8_3 = 0;
+    Real out_8_4 = sqrt(L * L - r * r * t2 * t2);
+    Real out_8_5 = r * t2;
+    Real out_8_6 = 0;
+    Real out_8_7 = 0;
+    Real out_8_8 = 0;
+    Real out_8_9 = 0;
+    Real out_9_0 = 0;
+    Real out_9_1 = 0;
+    Real out_9_2 = 0;
+    Real out_9_3 = 0;
+    Real out_9_4 = 2 * t3;
+    Real out_9_5 = 2 * t4;
+    Real out_9_6 = -2 * t3;
+    Real out_9_7 = -2 * t4;
+    Real out_9_8 = 0;
+    Real out_9_9 = 0;
+
+    // Return results
+    MatrixJF out_JF_x_dot;
+    out_JF_x_dot <<
+      out_0_0, out_0_1, out_0_2, out_0_3, out_0_4, out_0_5, out_0_6, out_0_7, out_0_8, out_0_9, out_1_0, out_1_1, out_1_2, out_1_3, out_1_4, out_1_5, out_1_6, out_1_7, out_1_8, out_1_9, out_2_0, out_2_1, out_2_2, out_2_3, out_2_4, out_2_5, out_2_6, out_2_7, out_2_8, out_2_9, out_3_0, out_3_1, out_3_2, out_3_3, out_3_4, out_3_5, out_3_6, out_3_7, out_3_8, out_3_9, out_4_0, out_4_1, out_4_2, out_4_3, out_4_4, out_4_5, out_4_6, out_4_7, out_4_8, out_4_9, out_5_0, out_5_1, out_5_2, out_5_3, out_5_4, out_5_5, out_5_6, out_5_7, out_5_8, out_5_9, out_6_0, out_6_1, out_6_2, out_6_3, out_6_4, out_6_5, out_6_6, out_6_7, out_6_8, out_6_9, out_7_0, out_7_1, out_7_2, out_7_3, out_7_4, out_7_5, out_7_6, out_7_7, out_7_8, out_7_9, out_8_0, out_8_1, out_8_2, out_8_3, out_8_4, out_8_5, out_8_6, out_8_7, out_8_8, out_8_9, out_9_0, out_9_1, out_9_2, out_9_3, out_9_4, out_9_5, out_9_6, out_9_7, out_9_8, out_9_9;
+    return out_JF_x_dot;
+  }
+
+  // Calculate the vector h of the invariants.
+  VectorH h(VectorF const & /*in_0*/, Real /*in_1*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    // Nothing to evaluate
+
+    // Return results
+    VectorH out_h;
+    out_h.setZero();
+    return out_h;
+  }
+
+  // Calculate the Jacobian of h with respect to x.
+  MatrixJH Jh_x(VectorF const & /*in_0*/, Real /*in_1*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    // Nothing to evaluate
+
+    // Return results
+    MatrixJH out_Jh_x;
+    out_Jh_x.setZero();
+    return out_Jh_x;
+  }
+
+  // Check if the system is in the defined domain.
+  bool in_domain(VectorF const &/*x*/, Real /*t*/) const override {return true;}
+
+  // Return the initial integration time
+  Real t_ini() const {return 0.;}
+
+  // Return the final integration time
+  Real t_end() const {return 3.0;}
+
+  // Evaluate the initial conditions.
+  VectorF ics() const
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0 = 0.0e0;
+    Real out_1 = 0.5e0;
+    Real out_2 = 0.1e1;
+    Real out_3 = 0.5e0;
+    Real out_4 = -0.5e0;
+    Real out_5 = 0.0e0;
+    Real out_6 = -0.5e0;
+    Real out_7 = 0.0e0;
+    Real out_8 = 0.0e0;
+    Real out_9 = 0.0e0;
+
+    // Return results
+    VectorF out_ics;
+    out_ics <<
+      out_0, out_1, out_2, out_3, out_4, out_5, out_6, out_7, out_8, out_9;
+    return out_ics;
+  }
+
+}; // class CarAxis
+
+#endif // SANDALS_MAPLE_CARAXIS_IMPLICIT_HH
@@ -19,7 +19,8 @@ using namespace Sandals;
 using namespace std;
 
 // No class description available.
-class ChemAkzo : public Implicit<6, 0>
+template<typename Real = double>
+class ChemAkzo : public Implicit<Real, 6, 0>
 {
   // Class data
   Real m_k_1{18.7}; // Data variable 1
@@ -33,13 +34,13 @@ class ChemAkzo : public Implicit<6, 0>
   Real m_H{737.0}; // Data variable 9
 
 public:
-  using VectorF  = typename Implicit<6, 0>::VectorF;
-  using MatrixJF = typename Implicit<6, 0>::MatrixJF;
-  using VectorH  = typename Implicit<6, 0>::VectorH;
-  using MatrixJH = typename Implicit<6, 0>::MatrixJH;
+  using VectorF  = typename Implicit<Real, 6, 0>::VectorF;
+  using MatrixJF = typename Implicit<Real, 6, 0>::MatrixJF;
+  using VectorH  = typename Implicit<Real, 6, 0>::VectorH;
+  using MatrixJH = typename Implicit<Real, 6, 0>::MatrixJH;
 
   // Class constructor.
-  ChemAkzo() : Implicit<6, 0>("ChemAkzo") {}
+  ChemAkzo() : Implicit<Real, 6, 0>("ChemAkzo") {}
 
   // Data variable 1 getter.
   Real get_k_1() const {return this->m_k_1;}
@@ -237,7 +238,7 @@ public:
     // Return results
     MatrixJF out_JF_x;
     out_JF_x <<
-      out_0_0, out_0_1, out_0_2, out_0_3, out_0_4, out_0_5, out_1_0, out_1_1, out_1_2, out_1_3, out_1_4, out_1_5, out_2_0, out_2_1, out_2_2, out_2_3, out_2_4, out_2_5, out_3_0, out_3_1, out_3_2, out_3_3, out_3_4, out_3_5, out_4_0, out_4_1, out_4_2, out_4_3, out_4_4, out_4_5, out_5_0, out_5_1, out_5_2, out_5_3, out_5_4, out_5_5;
+      out_0_0, out_1_0, out_2_0, out_3_0, out_4_0, out_5_0, out_0_1, out_1_1, out_2_1, out_3_1, out_4_1, out_5_1, out_0_2, out_1_2, out_2_2, out_3_2, out_4_2, out_5_2, out_0_3, out_1_3, out_2_3, out_3_3, out_4_3, out_5_3, out_0_4, out_1_4, out_2_4, out_3_4, out_4_4, out_5_4, out_0_5, out_1_5, out_2_5, out_3_5, out_4_5, out_5_5;
     return out_JF_x;
   }
   // Evaluate the Jacobian of F with respect to x_dot.
@@ -253,11 +254,47 @@ public:
     // Nothing to evaluate
 
     // Evaluate function entries
-    // Nothing to evaluate
+    Real out_0_0 = 1;
+    Real out_0_1 = 0;
+    Real out_0_2 = 0;
+    Real out_0_3 = 0;
+    Real out_0_4 = 0;
+    Real out_0_5 = 0;
+    Real out_1_0 = 0;
+    Real out_1_1 = 1;
+    Real out_1_2 = 0;
+    Real out_1_3 = 0;
+    Real out_1_4 = 0;
+    Real out_1_5 = 0;
+    Real out_2_0 = 0;
+    Real out_2_1 = 0;
+    Real out_2_2 = 1;
+    Real out_2_3 = 0;
+    Real out_2_4 = 0;
+    Real out_2_5 = 0;
+    Real out_3_0 = 0;
+    Real out_3_1 = 0;
+    Real out_3_2 = 0;
+    Real out_3_3 = 1;
+    Real out_3_4 = 0;
+    Real out_3_5 = 0;
+    Real out_4_0 = 0;
+    Real out_4_1 = 0;
+    Real out_4_2 = 0;
+    Real out_4_3 = 0;
+    Real out_4_4 = 1;
+    Real out_4_5 = 0;
+    Real out_5_0 = 0;
+    Real out_5_1 = 0;
+    Real out_5_2 = 0;
+    Real out_5_3 = 0;
+    Real out_5_4 = 0;
+    Real out_5_5 = 0;
 
     // Return results
     MatrixJF out_JF_x_dot;
-    out_JF_x_dot.setZero();
+    out_JF_x_dot <<
+      out_0_0, out_0_1, out_0_2, out_0_3, out_0_4, out_0_5, out_1_0, out_1_1, out_1_2, out_1_3, out_1_4, out_1_5, out_2_0, out_2_1, out_2_2, out_2_3, out_2_4, out_2_5, out_3_0, out_3_1, out_3_2, out_3_3, out_3_4, out_3_5, out_4_0, out_4_1, out_4_2, out_4_3, out_4_4, out_4_5, out_5_0, out_5_1, out_5_2, out_5_3, out_5_4, out_5_5;
     return out_JF_x_dot;
   }
 
@@ -0,0 +1,330 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// C++ generated code for implicit system: HIRES
+// This file has been automatically generated by Sandals.
+// DISCLAIMER: If you need to edit it, do it wisely!
+
+#ifndef SANDALS_MAPLE_HIRES_IMPLICIT_HH
+#define SANDALS_MAPLE_HIRES_IMPLICIT_HH
+
+using namespace Sandals;
+using namespace std;
+
+// No class description available.
+template<typename Real = double>
+class HIRES : public Implicit<Real, 8, 0>
+{
+public:
+  using VectorF  = typename Implicit<Real, 8, 0>::VectorF;
+  using MatrixJF = typename Implicit<Real, 8, 0>::MatrixJF;
+  using VectorH  = typename Implicit<Real, 8, 0>::VectorH;
+  using MatrixJH = typename Implicit<Real, 8, 0>::MatrixJH;
+
+  // Class constructor.
+  HIRES() : Implicit<Real, 8, 0>("HIRES") {}
+
+  // Evaluate the function F.
+  VectorF F(VectorF const & in_0, VectorF const & in_1, Real /*in_2*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    Real const & y_1 = in_0(0); // State variable 1
+    Real const & y_2 = in_0(1); // State variable 2
+    Real const & y_3 = in_0(2); // State variable 3
+    Real const & y_4 = in_0(3); // State variable 4
+    Real const & y_5 = in_0(4); // State variable 5
+    Real const & y_6 = in_0(5); // State variable 6
+    Real const & y_7 = in_0(6); // State variable 7
+    Real const & y_8 = in_0(7); // State variable 8
+    Real const & y_1_dot = in_1(0); // State variable 1 derivative
+    Real const & y_2_dot = in_1(1); // State variable 2 derivative
+    Real const & y_3_dot = in_1(2); // State variable 3 derivative
+    Real const & y_4_dot = in_1(3); // State variable 4 derivative
+    Real const & y_5_dot = in_1(4); // State variable 5 derivative
+    Real const & y_6_dot = in_1(5); // State variable 6 derivative
+    Real const & y_7_dot = in_1(6); // State variable 7 derivative
+    Real const & y_8_dot = in_1(7); // State variable 8 derivative
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0 = y_1_dot + 0.171e1 * y_1 - 0.43e0 * y_2 - 0.832e1 * y_3 - 0.7e-3;
+    Real out_1 = y_2_dot - 0.171e1 * y_1 + 0.875e1 * y_2;
+    Real out_2 = y_3_dot + 0.1003e2 * y_3 - 0.43e0 * y_4 - 0.35e-1 * y_5;
+    Real out_3 = y_4_dot - 0.832e1 * y_2 - 0.171e1 * y_3 + 0.112e1 * y_4;
+    Real out_4 = y_5_dot + 0.1745e1 * y_5 - 0.43e0 * y_6 - 0.43e0 * y_7;
+    Real out_5 = y_6_dot + 0.28e3 * y_6 * y_8 - 0.69e0 * y_4 - 0.171e1 * y_5 + 0.43e0 * y_6 - 0.69e0 * y_7;
+    Real out_6 = y_7_dot - 0.28e3 * y_6 * y_8 + 0.181e1 * y_7;
+    Real out_7 = y_8_dot + 0.28e3 * y_6 * y_8 - 0.181e1 * y_7;
+
+    // Return results
+    VectorF out_F;
+    out_F <<
+      out_0, out_1, out_2, out_3, out_4, out_5, out_6, out_7;
+    return out_F;
+  }
+
+  // Evaluate the Jacobian of F with respect to x.
+  MatrixJF JF_x(VectorF const & in_0, VectorF const & /*in_1*/, Real /*in_2*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    Real const & y_6 = in_0(5); // State variable 6
+    Real const & y_8 = in_0(7); // State variable 8
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0_0 = 0.171e1;
+    Real out_0_1 = -0.43e0;
+    Real out_0_2 = -0.832e1;
+    Real out_0_3 = 0;
+    Real out_0_4 = 0;
+    Real out_0_5 = 0;
+    Real out_0_6 = 0;
+    Real out_0_7 = 0;
+    Real out_1_0 = -0.171e1;
+    Real out_1_1 = 0.875e1;
+    Real out_1_2 = 0;
+    Real out_1_3 = 0;
+    Real out_1_4 = 0;
+    Real out_1_5 = 0;
+    Real out_1_6 = 0;
+    Real out_1_7 = 0;
+    Real out_2_0 = 0;
+    Real out_2_1 = 0;
+    Real out_2_2 = 0.1003e2;
+    Real out_2_3 = -0.43e0;
+    Real out_2_4 = -0.35e-1;
+    Real out_2_5 = 0;
+    Real out_2_6 = 0;
+    Real out_2_7 = 0;
+    Real out_3_0 = 0;
+    Real out_3_1 = -0.832e1;
+    Real out_3_2 = -0.171e1;
+    Real out_3_3 = 0.112e1;
+    Real out_3_4 = 0;
+    Real out_3_5 = 0;
+    Real out_3_6 = 0;
+    Real out_3_7 = 0;
+    Real out_4_0 = 0;
+    Real out_4_1 = 0;
+    Real out_4_2 = 0;
+    Real out_4_3 = 0;
+    Real out_4_4 = 0.1745e1;
+    Real out_4_5 = -0.43e0;
+    Real out_4_6 = -0.43e0;
+    Real out_4_7 = 0;
+    Real out_5_0 = 0;
+    Real out_5_1 = 0;
+    Real out_5_2 = 0;
+    Real out_5_3 = -0.69e0;
+    Real out_5_4 = -0.171e1;
+    Real out_5_5 = 0.28e3 * y_8 + 0.43e0;
+    Real out_5_6 = -0.69e0;
+    Real out_5_7 = 0.28e3 * y_6;
+    Real out_6_0 = 0;
+    Real out_6_1 = 0;
+    Real out_6_2 = 0;
+    Real out_6_3 = 0;
+    Real out_6_4 = 0;
+    Real out_6_5 = -0.28e3 * y_8;
+    Real out_6_6 = 0.181e1;
+    Real out_6_7 = -0.28e3 * y_6;
+    Real out_7_0 = 0;
+    Real out_7_1 = 0;
+    Real out_7_2 = 0;
+    Real out_7_3 = 0;
+    Real out_7_4 = 0;
+    Real out_7_5 = 0.28e3 * y_8;
+    Real out_7_6 = -0.181e1;
+    Real out_7_7 = 0.28e3 * y_6;
+
+    // Return results
+    MatrixJF out_JF_x;
+    out_JF_x <<
+      out_0_0, out_0_1, out_0_2, out_0_3, out_0_4, out_0_5, out_0_6, out_0_7, out_1_0, out_1_1, out_1_2, out_1_3, out_1_4, out_1_5, out_1_6, out_1_7, out_2_0, out_2_1, out_2_2, out_2_3, out_2_4, out_2_5, out_2_6, out_2_7, out_3_0, out_3_1, out_3_2, out_3_3, out_3_4, out_3_5, out_3_6, out_3_7, out_4_0, out_4_1, out_4_2, out_4_3, out_4_4, out_4_5, out_4_6, out_4_7, out_5_0, out_5_1, out_5_2, out_5_3, out_5_4, out_5_5, out_5_6, out_5_7, out_6_0, out_6_1, out_6_2, out_6_3, out_6_4, out_6_5, out_6_6, out_6_7, out_7_0, out_7_1, out_7_2, out_7_3, out_7_4, out_7_5, out_7_6, out_7_7;
+    return out_JF_x;
+  }
+  // Evaluate the Jacobian of F with respect to x_dot.
+  MatrixJF JF_x_dot(VectorF const & /*in_0*/, VectorF const & /*in_1*/, Real /*in_2*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0_0 = 1;
+    Real out_0_1 = 0;
+    Real out_0_2 = 0;
+    Real out_0_3 = 0;
+    Real out_0_4 = 0;
+    Real out_0_5 = 0;
+    Real out_0_6 = 0;
+    Real out_0_7 = 0;
+    Real out_1_0 = 0;
+    Real out_1_1 = 1;
+    Real out_1_2 = 0;
+    Real out_1_3 = 0;
+    Real out_1_4 = 0;
+    Real out_1_5 = 0;
+    Real out_1_6 = 0;
+    Real out_1_7 = 0;
+    Real out_2_0 = 0;
+    Real out_2_1 = 0;
+    Real out_2_2 = 1;
+    Real out_2_3 = 0;
+    Real out_2_4 = 0;
+    Real out_2_5 = 0;
+    Real out_2_6 = 0;
+    Real out_2_7 = 0;
+    Real out_3_0 = 0;
+    Real out_3_1 = 0;
+    Real out_3_2 = 0;
+    Real out_3_3 = 1;
+    Real out_3_4 = 0;
+    Real out_3_5 = 0;
+    Real out_3_6 = 0;
+    Real out_3_7 = 0;
+    Real out_4_0 = 0;
+    Real out_4_1 = 0;
+    Real out_4_2 = 0;
+    Real out_4_3 = 0;
+    Real out_4_4 = 1;
+    Real out_4_5 = 0;
+    Real out_4_6 = 0;
+    Real out_4_7 = 0;
+    Real out_5_0 = 0;
+    Real out_5_1 = 0;
+    Real out_5_2 = 0;
+    Real out_5_3 = 0;
+    Real out_5_4 = 0;
+    Real out_5_5 = 1;
+    Real out_5_6 = 0;
+    Real out_5_7 = 0;
+    Real out_6_0 = 0;
+    Real out_6_1 = 0;
+    Real out_6_2 = 0;
+    Real out_6_3 = 0;
+    Real out_6_4 = 0;
+    Real out_6_5 = 0;
+    Real out_6_6 = 1;
+    Real out_6_7 = 0;
+    Real out_7_0 = 0;
+    Real out_7_1 = 0;
+    Real out_7_2 = 0;
+    Real out_7_3 = 0;
+    Real out_7_4 = 0;
+    Real out_7_5 = 0;
+    Real out_7_6 = 0;
+    Real out_7_7 = 1;
+
+    // Return results
+    MatrixJF out_JF_x_dot;
+    out_JF_x_dot <<
+      out_0_0, out_0_1, out_0_2, out_0_3, out_0_4, out_0_5, out_0_6, out_0_7, out_1_0, out_1_1, out_1_2, out_1_3, out_1_4, out_1_5, out_1_6, out_1_7, out_2_0, out_2_1, out_2_2, out_2_3, out_2_4, out_2_5, out_2_6, out_2_7, out_3_0, out_3_1, out_3_2, out_3_3, out_3_4, out_3_5, out_3_6, out_3_7, out_4_0, out_4_1, out_4_2, out_4_3, out_4_4, out_4_5, out_4_6, out_4_7, out_5_0, out_5_1, out_5_2, out_5_3, out_5_4, out_5_5, out_5_6, out_5_7, out_6_0, out_6_1, out_6_2, out_6_3, out_6_4, out_6_5, out_6_6, out_6_7, out_7_0, out_7_1, out_7_2, out_7_3, out_7_4, out_7_5, out_7_6, out_7_7;
+    return out_JF_x_dot;
+  }
+
+  // Calculate the vector h of the invariants.
+  VectorH h(VectorF const & /*in_0*/, Real /*in_1*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    // Nothing to evaluate
+
+    // Return results
+    VectorH out_h;
+    out_h.setZero();
+    return out_h;
+  }
+
+  // Calculate the Jacobian of h with respect to x.
+  MatrixJH Jh_x(VectorF const & /*in_0*/, Real /*in_1*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    // Nothing to evaluate
+
+    // Return results
+    MatrixJH out_Jh_x;
+    out_Jh_x.setZero();
+    return out_Jh_x;
+  }
+
+  // Check if the system is in the defined domain.
+  bool in_domain(VectorF const &/*x*/, Real /*t*/) const override {return true;}
+
+  // Return the initial integration time
+  Real t_ini() const {return 0.;}
+
+  // Return the final integration time
+  Real t_end() const {return 321.8122;}
+
+  // Evaluate the initial conditions.
+  VectorF ics() const
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0 = 0.1e1;
+    Real out_1 = 0.0e0;
+    Real out_2 = 0.0e0;
+    Real out_3 = 0.0e0;
+    Real out_4 = 0.0e0;
+    Real out_5 = 0.0e0;
+    Real out_6 = 0.0e0;
+    Real out_7 = 0.57e-2;
+
+    // Return results
+    VectorF out_ics;
+    out_ics <<
+      out_0, out_1, out_2, out_3, out_4, out_5, out_6, out_7;
+    return out_ics;
+  }
+
+}; // class HIRES
+
+#endif // SANDALS_MAPLE_HIRES_IMPLICIT_HH
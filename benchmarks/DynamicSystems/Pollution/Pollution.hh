@@ -0,0 +1,1280 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// C++ generated code for implicit system: Pollution
+// This file has been automatically generated by Sandals.
+// DISCLAIMER: If you need to edit it, do it wisely!
+
+#ifndef SANDALS_MAPLE_POLLUTION_IMPLICIT_HH
+#define SANDALS_MAPLE_POLLUTION_IMPLICIT_HH
+
+using namespace Sandals;
+using namespace std;
+
+// No class description available.
+template<typename Real = double>
+class Pollution : public Implicit<Real, 20, 0>
+{
+  // Class data
+  Real m_k_1{.35}; // Data variable 1
+  Real m_k_2{26.6}; // Data variable 2
+  Real m_k_3{12300.0}; // Data variable 3
+  Real m_k_4{.86e-3}; // Data variable 4
+  Real m_k_5{.82e-3}; // Data variable 5
+  Real m_k_6{15000.0}; // Data variable 6
+  Real m_k_7{.13e-3}; // Data variable 7
+  Real m_k_8{24000.0}; // Data variable 8
+  Real m_k_9{16500.0}; // Data variable 9
+  Real m_k_10{9000.0}; // Data variable 10
+  Real m_k_11{.22e-1}; // Data variable 11
+  Real m_k_12{12000.0}; // Data variable 12
+  Real m_k_13{1.88}; // Data variable 13
+  Real m_k_14{16300.0}; // Data variable 14
+  Real m_k_15{.48e7}; // Data variable 15
+  Real m_k_16{.35e-3}; // Data variable 16
+  Real m_k_17{.175e-1}; // Data variable 17
+  Real m_k_18{.1e9}; // Data variable 18
+  Real m_k_19{.444e12}; // Data variable 19
+  Real m_k_20{1240.0}; // Data variable 20
+  Real m_k_21{2.1}; // Data variable 21
+  Real m_k_22{5.78}; // Data variable 22
+  Real m_k_23{.474e-1}; // Data variable 23
+  Real m_k_24{1780.0}; // Data variable 24
+  Real m_k_25{3.12}; // Data variable 25
+
+public:
+  using VectorF  = typename Implicit<Real, 20, 0>::VectorF;
+  using MatrixJF = typename Implicit<Real, 20, 0>::MatrixJF;
+  using VectorH  = typename Implicit<Real, 20, 0>::VectorH;
+  using MatrixJH = typename Implicit<Real, 20, 0>::MatrixJH;
+
+  // Class constructor.
+  Pollution() : Implicit<Real, 20, 0>("Pollution") {}
+
+  // Data variable 1 getter.
+  Real get_k_1() const {return this->m_k_1;}
+
+  // Data variable 1 setter.
+  void set_k_1(Real t_k_1) {this->m_k_1 = t_k_1;}
+
+  // Data variable 2 getter.
+  Real get_k_2() const {return this->m_k_2;}
+
+  // Data variable 2 setter.
+  void set_k_2(Real t_k_2) {this->m_k_2 = t_k_2;}
+
+  // Data variable 3 getter.
+  Real get_k_3() const {return this->m_k_3;}
+
+  // Data variable 3 setter.
+  void set_k_3(Real t_k_3) {this->m_k_3 = t_k_3;}
+
+  // Data variable 4 getter.
+  Real get_k_4() const {return this->m_k_4;}
+
+  // Data variable 4 setter.
+  void set_k_4(Real t_k_4) {this->m_k_4 = t_k_4;}
+
+  // Data variable 5 getter.
+  Real get_k_5() const {return this->m_k_5;}
+
+  // Data variable 5 setter.
+  void set_k_5(Real t_k_5) {this->m_k_5 = t_k_5;}
+
+  // Data variable 6 getter.
+  Real get_k_6() const {return this->m_k_6;}
+
+  // Data variable 6 setter.
+  void set_k_6(Real t_k_6) {this->m_k_6 = t_k_6;}
+
+  // Data variable 7 getter.
+  Real get_k_7() const {return this->m_k_7;}
+
+  // Data variable 7 setter.
+  void set_k_7(Real t_k_7) {this->m_k_7 = t_k_7;}
+
+  // Data variable 8 getter.
+  Real get_k_8() const {return this->m_k_8;}
+
+  // Data variable 8 setter.
+  void set_k_8(Real t_k_8) {this->m_k_8 = t_k_8;}
+
+  // Data variable 9 getter.
+  Real get_k_9() const {return this->m_k_9;}
+
+  // Data variable 9 setter.
+  void set_k_9(Real t_k_9) {this->m_k_9 = t_k_9;}
+
+  // Data variable 10 getter.
+  Real get_k_10() const {return this->m_k_10;}
+
+  // Data variable 10 setter.
+  void set_k_10(Real t_k_10) {this->m_k_10 = t_k_10;}
+
+  // Data variable 11 getter.
+  Real get_k_11() const {return this->m_k_11;}
+
+  // Data variable 11 setter.
+  void set_k_11(Real t_k_11) {this->m_k_11 = t_k_11;}
+
+  // Data variable 12 getter.
+  Real get_k_12() const {return this->m_k_12;}
+
+  // Data variable 12 setter.
+  void set_k_12(Real t_k_12) {this->m_k_12 = t_k_12;}
+
+  // Data variable 13 getter.
+  Real get_k_13() const {return this->m_k_13;}
+
+  // Data variable 13 setter.
+  void set_k_13(Real t_k_13) {this->m_k_13 = t_k_13;}
+
+  // Data variable 14 getter.
+  Real get_k_14() const {return this->m_k_14;}
+
+  // Data variable 14 setter.
+  void set_k_14(Real t_k_14) {this->m_k_14 = t_k_14;}
+
+  // Data variable 15 getter.
+  Real get_k_15() const {return this->m_k_15;}
+
+  // Data variable 15 setter.
+  void set_k_15(Real t_k_15) {this->m_k_15 = t_k_15;}
+
+  // Data variable 16 getter.
+  Real get_k_16() const {return this->m_k_16;}
+
+  // Data variable 16 setter.
+  void set_k_16(Real t_k_16) {this->m_k_16 = t_k_16;}
+
+  // Data variable 17 getter.
+  Real get_k_17() const {return this->m_k_17;}
+
+  // Data variable 17 setter.
+  void set_k_17(Real t_k_17) {this->m_k_17 = t_k_17;}
+
+  // Data variable 18 getter.
+  Real get_k_18() const {return this->m_k_18;}
+
+  // Data variable 18 setter.
+  void set_k_18(Real t_k_18) {this->m_k_18 = t_k_18;}
+
+  // Data variable 19 getter.
+  Real get_k_19() const {return this->m_k_19;}
+
+  // Data variable 19 setter.
+  void set_k_19(Real t_k_19) {this->m_k_19 = t_k_19;}
+
+  // Data variable 20 getter.
+  Real get_k_20() const {return this->m_k_20;}
+
+  // Data variable 20 setter.
+  void set_k_20(Real t_k_20) {this->m_k_20 = t_k_20;}
+
+  // Data variable 21 getter.
+  Real get_k_21() const {return this->m_k_21;}
+
+  // Data variable 21 setter.
+  void set_k_21(Real t_k_21) {this->m_k_21 = t_k_21;}
+
+  // Data variable 22 getter.
+  Real get_k_22() const {return this->m_k_22;}
+
+  // Data variable 22 setter.
+  void set_k_22(Real t_k_22) {this->m_k_22 = t_k_22;}
+
+  // Data variable 23 getter.
+  Real get_k_23() const {return this->m_k_23;}
+
+  // Data variable 23 setter.
+  void set_k_23(Real t_k_23) {this->m_k_23 = t_k_23;}
+
+  // Data variable 24 getter.
+  Real get_k_24() const {return this->m_k_24;}
+
+  // Data variable 24 setter.
+  void set_k_24(Real t_k_24) {this->m_k_24 = t_k_24;}
+
+  // Data variable 25 getter.
+  Real get_k_25() const {return this->m_k_25;}
+
+  // Data variable 25 setter.
+  void set_k_25(Real t_k_25) {this->m_k_25 = t_k_25;}
+
+  // Evaluate the function F.
+  VectorF F(VectorF const & in_0, VectorF const & in_1, Real /*in_2*/) const override
+  {
+    // Create data' aliases
+    Real const & k_1 = this->m_k_1; // Data variable 1
+    Real const & k_2 = this->m_k_2; // Data variable 2
+    Real const & k_3 = this->m_k_3; // Data variable 3
+    Real const & k_4 = this->m_k_4; // Data variable 4
+    Real const & k_5 = this->m_k_5; // Data variable 5
+    Real const & k_6 = this->m_k_6; // Data variable 6
+    Real const & k_7 = this->m_k_7; // Data variable 7
+    Real const & k_8 = this->m_k_8; // Data variable 8
+    Real const & k_9 = this->m_k_9; // Data variable 9
+    Real const & k_10 = this->m_k_10; // Data variable 10
+    Real const & k_11 = this->m_k_11; // Data variable 11
+    Real const & k_12 = this->m_k_12; // Data variable 12
+    Real const & k_13 = this->m_k_13; // Data variable 13
+    Real const & k_14 = this->m_k_14; // Data variable 14
+    Real const & k_15 = this->m_k_15; // Data variable 15
+    Real const & k_16 = this->m_k_16; // Data variable 16
+    Real const & k_17 = this->m_k_17; // Data variable 17
+    Real const & k_18 = this->m_k_18; // Data variable 18
+    Real const & k_19 = this->m_k_19; // Data variable 19
+    Real const & k_20 = this->m_k_20; // Data variable 20
+    Real const & k_21 = this->m_k_21; // Data variable 21
+    Real const & k_22 = this->m_k_22; // Data variable 22
+    Real const & k_23 = this->m_k_23; // Data variable 23
+    Real const & k_24 = this->m_k_24; // Data variable 24
+    Real const & k_25 = this->m_k_25; // Data variable 25
+
+    // Create inputs' aliases
+    Real const & y_1 = in_0(0); // State variable 1
+    Real const & y_2 = in_0(1); // State variable 2
+    Real const & y_3 = in_0(2); // State variable 3
+    Real const & y_4 = in_0(3); // State variable 4
+    Real const & y_5 = in_0(4); // State variable 5
+    Real const & y_6 = in_0(5); // State variable 6
+    Real const & y_7 = in_0(6); // State variable 7
+    Real const & y_9 = in_0(8); // State variable 9
+    Real const & y_10 = in_0(9); // State variable 10
+    Real const & y_11 = in_0(10); // State variable 11
+    Real const & y_13 = in_0(12); // State variable 13
+    Real const & y_14 = in_0(13); // State variable 14
+    Real const & y_16 = in_0(15); // State variable 16
+    Real const & y_17 = in_0(16); // State variable 17
+    Real const & y_19 = in_0(18); // State variable 19
+    Real const & y_20 = in_0(19); // State variable 20
+    Real const & y_1_dot = in_1(0); // State variable 1 derivative
+    Real const & y_2_dot = in_1(1); // State variable 2 derivative
+    Real const & y_3_dot = in_1(2); // State variable 3 derivative
+    Real const & y_4_dot = in_1(3); // State variable 4 derivative
+    Real const & y_5_dot = in_1(4); // State variable 5 derivative
+    Real const & y_6_dot = in_1(5); // State variable 6 derivative
+    Real const & y_7_dot = in_1(6); // State variable 7 derivative
+    Real const & y_8_dot = in_1(7); // State variable 8 derivative
+    Real const & y_9_dot = in_1(8); // State variable 9 derivative
+    Real const & y_10_dot = in_1(9); // State variable 10 derivative
+    Real const & y_11_dot = in_1(10); // State variable 11 derivative
+    Real const & y_12_dot = in_1(11); // State variable 12 derivative
+    Real const & y_13_dot = in_1(12); // State variable 13 derivative
+    Real const & y_14_dot = in_1(13); // State variable 14 derivative
+    Real const & y_15_dot = in_1(14); // State variable 15 derivative
+    Real const & y_16_dot = in_1(15); // State variable 16 derivative
+    Real const & y_17_dot = in_1(16); // State variable 17 derivative
+    Real const & y_18_dot = in_1(17); // State variable 18 derivative
+    Real const & y_19_dot = in_1(18); // State variable 19 derivative
+    Real const & y_20_dot = in_1(19); // State variable 20 derivative
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0 = y_1_dot + k_1 * y_1 + k_10 * y_11 * y_1 + k_14 * y_1 * y_6 + k_23 * y_1 * y_4 + k_24 * y_19 * y_1 - k_2 * y_2 * y_4 - k_3 * y_5 * y_2 - k_9 * y_11 * y_2 - k_11 * y_13 - k_12 * y_10 * y_2 - k_22 * y_19 - k_25 * y_20;
+    Real out_1 = y_2_dot + k_2 * y_2 * y_4 + k_3 * y_5 * y_2 + k_9 * y_11 * y_2 + k_12 * y_10 * y_2 - k_1 * y_1 - k_21 * y_19;
+    Real out_2 = y_3_dot + k_15 * y_3 - k_1 * y_1 - k_17 * y_4 - k_19 * y_16 - k_22 * y_19;
+    Real out_3 = y_4_dot + k_2 * y_2 * y_4 + k_16 * y_4 + k_17 * y_4 + k_23 * y_1 * y_4 - k_15 * y_3;
+    Real out_4 = y_5_dot + k_3 * y_5 * y_2 - 2 * k_4 * y_7 - k_6 * y_7 * y_6 - k_7 * y_9 - k_13 * y_14 - k_20 * y_17 * y_6;
+    Real out_5 = y_6_dot + k_6 * y_7 * y_6 + k_8 * y_9 * y_6 + k_14 * y_1 * y_6 + k_20 * y_17 * y_6 - k_3 * y_5 * y_2 - 2 * k_18 * y_16;
+    Real out_6 = y_7_dot + k_4 * y_7 + k_5 * y_7 + k_6 * y_7 * y_6 - k_13 * y_14;
+    Real out_7 = y_8_dot - k_4 * y_7 - k_5 * y_7 - k_6 * y_7 * y_6 - k_7 * y_9;
+    Real out_8 = y_9_dot + k_7 * y_9 + k_8 * y_9 * y_6;
+    Real out_9 = y_10_dot + k_12 * y_10 * y_2 - k_7 * y_9 - k_9 * y_11 * y_2;
+    Real out_10 = y_11_dot + k_9 * y_11 * y_2 + k_10 * y_11 * y_1 - k_8 * y_9 * y_6 - k_11 * y_13;
+    Real out_11 = y_12_dot - k_9 * y_11 * y_2;
+    Real out_12 = y_13_dot + k_11 * y_13 - k_10 * y_11 * y_1;
+    Real out_13 = y_14_dot + k_13 * y_14 - k_12 * y_10 * y_2;
+    Real out_14 = y_15_dot - k_14 * y_1 * y_6;
+    Real out_15 = y_16_dot + k_18 * y_16 + k_19 * y_16 - k_16 * y_4;
+    Real out_16 = y_17_dot + k_20 * y_17 * y_6;
+    Real out_17 = y_18_dot - k_20 * y_17 * y_6;
+    Real out_18 = y_19_dot + k_21 * y_19 + k_22 * y_19 + k_24 * y_19 * y_1 - k_23 * y_1 * y_4 - k_25 * y_20;
+    Real out_19 = y_20_dot + k_25 * y_20 - k_24 * y_19 * y_1;
+
+    // Return results
+    VectorF out_F;
+    out_F <<
+      out_0, out_1, out_2, out_3, out_4, out_5, out_6, out_7, out_8, out_9, out_10, out_11, out_12, out_13, out_14, out_15, out_16, out_17, out_18, out_19;
+    return out_F;
+  }
+
+  // Evaluate the Jacobian of F with respect to x.
+  MatrixJF JF_x(VectorF const & in_0, VectorF const & /*in_1*/, Real /*in_2*/) const override
+  {
+    // Create data' aliases
+    Real const & k_1 = this->m_k_1; // Data variable 1
+    Real const & k_2 = this->m_k_2; // Data variable 2
+    Real const & k_3 = this->m_k_3; // Data variable 3
+    Real const & k_4 = this->m_k_4; // Data variable 4
+    Real const & k_5 = this->m_k_5; // Data variable 5
+    Real const & k_6 = this->m_k_6; // Data variable 6
+    Real const & k_7 = this->m_k_7; // Data variable 7
+    Real const & k_8 = this->m_k_8; // Data variable 8
+    Real const & k_9 = this->m_k_9; // Data variable 9
+    Real const & k_10 = this->m_k_10; // Data variable 10
+    Real const & k_11 = this->m_k_11; // Data variable 11
+    Real const & k_12 = this->m_k_12; // Data variable 12
+    Real const & k_13 = this->m_k_13; // Data variable 13
+    Real const & k_14 = this->m_k_14; // Data variable 14
+    Real const & k_15 = this->m_k_15; // Data variable 15
+    Real const & k_16 = this->m_k_16; // Data variable 16
+    Real const & k_17 = this->m_k_17; // Data variable 17
+    Real const & k_18 = this->m_k_18; // Data variable 18
+    Real const & k_19 = this->m_k_19; // Data variable 19
+    Real const & k_20 = this->m_k_20; // Data variable 20
+    Real const & k_21 = this->m_k_21; // Data variable 21
+    Real const & k_22 = this->m_k_22; // Data variable 22
+    Real const & k_23 = this->m_k_23; // Data variable 23
+    Real const & k_24 = this->m_k_24; // Data variable 24
+    Real const & k_25 = this->m_k_25; // Data variable 25
+
+    // Create inputs' aliases
+    Real const & y_1 = in_0(0); // State variable 1
+    Real const & y_2 = in_0(1); // State variable 2
+    Real const & y_4 = in_0(3); // State variable 4
+    Real const & y_5 = in_0(4); // State variable 5
+    Real const & y_6 = in_0(5); // State variable 6
+    Real const & y_7 = in_0(6); // State variable 7
+    Real const & y_9 = in_0(8); // State variable 9
+    Real const & y_10 = in_0(9); // State variable 10
+    Real const & y_11 = in_0(10); // State variable 11
+    Real const & y_17 = in_0(16); // State variable 17
+    Real const & y_19 = in_0(18); // State variable 19
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0_0 = k_1 + k_10 * y_11 + k_14 * y_6 + k_23 * y_4 + k_24 * y_19;
+    Real out_0_1 = -k_2 * y_4 - k_3 * y_5 - k_9 * y_11 - k_12 * y_10;
+    Real out_0_2 = 0;
+    Real out_0_3 = k_23 * y_1 - k_2 * y_2;
+    Real out_0_4 = -k_3 * y_2;
+    Real out_0_5 = k_14 * y_1;
+    Real out_0_6 = 0;
+    Real out_0_7 = 0;
+    Real out_0_8 = 0;
+    Real out_0_9 = -k_12 * y_2;
+    Real out_0_10 = k_10 * y_1 - k_9 * y_2;
+    Real out_0_11 = 0;
+    Real out_0_12 = -k_11;
+    Real out_0_13 = 0;
+    Real out_0_14 = 0;
+    Real out_0_15 = 0;
+    Real out_0_16 = 0;
+    Real out_0_17 = 0;
+    Real out_0_18 = k_24 * y_1 - k_22;
+    Real out_0_19 = -k_25;
+    Real out_1_0 = -k_1;
+    Real out_1_1 = k_2 * y_4 + k_3 * y_5 + k_9 * y_11 + k_12 * y_10;
+    Real out_1_2 = 0;
+    Real out_1_3 = k_2 * y_2;
+    Real out_1_4 = k_3 * y_2;
+    Real out_1_5 = 0;
+    Real out_1_6 = 0;
+    Real out_1_7 = 0;
+    Real out_1_8 = 0;
+    Real out_1_9 = k_12 * y_2;
+    Real out_1_10 = k_9 * y_2;
+    Real out_1_11 = 0;
+    Real out_1_12 = 0;
+    Real out_1_13 = 0;
+    Real out_1_14 = 0;
+    Real out_1_15 = 0;
+    Real out_1_16 = 0;
+    Real out_1_17 = 0;
+    Real out_1_18 = -k_21;
+    Real out_1_19 = 0;
+    Real out_2_0 = -k_1;
+    Real out_2_1 = 0;
+    Real out_2_2 = k_15;
+    Real out_2_3 = -k_17;
+    Real out_2_4 = 0;
+    Real out_2_5 = 0;
+    Real out_2_6 = 0;
+    Real out_2_7 = 0;
+    Real out_2_8 = 0;
+    Real out_2_9 = 0;
+    Real out_2_10 = 0;
+    Real out_2_11 = 0;
+    Real out_2_12 = 0;
+    Real out_2_13 = 0;
+    Real out_2_14 = 0;
+    Real out_2_15 = -k_19;
+    Real out_2_16 = 0;
+    Real out_2_17 = 0;
+    Real out_2_18 = -k_22;
+    Real out_2_19 = 0;
+    Real out_3_0 = k_23 * y_4;
+    Real out_3_1 = k_2 * y_4;
+    Real out_3_2 = -k_15;
+    Real out_3_3 = k_2 * y_2 + k_16 + k_17 + k_23 * y_1;
+    Real out_3_4 = 0;
+    Real out_3_5 = 0;
+    Real out_3_6 = 0;
+    Real out_3_7 = 0;
+    Real out_3_8 = 0;
+    Real out_3_9 = 0;
+    Real out_3_10 = 0;
+    Real out_3_11 = 0;
+    Real out_3_12 = 0;
+    Real out_3_13 = 0;
+    Real out_3_14 = 0;
+    Real out_3_15 = 0;
+    Real out_3_16 = 0;
+    Real out_3_17 = 0;
+    Real out_3_18 = 0;
+    Real out_3_19 = 0;
+    Real out_4_0 = 0;
+    Real out_4_1 = k_3 * y_5;
+    Real out_4_2 = 0;
+    Real out_4_3 = 0;
+    Real out_4_4 = k_3 * y_2;
+    Real out_4_5 = -k_6 * y_7 - k_20 * y_17;
+    Real out_4_6 = -2 * k_4 - k_6 * y_6;
+    Real out_4_7 = 0;
+    Real out_4_8 = -k_7;
+    Real out_4_9 = 0;
+    Real out_4_10 = 0;
+    Real out_4_11 = 0;
+    Real out_4_12 = 0;
+    Real out_4_13 = -k_13;
+    Real out_4_14 = 0;
+    Real out_4_15 = 0;
+    Real out_4_16 = -k_20 * y_6;
+    Real out_4_17 = 0;
+    Real out_4_18 = 0;
+    Real out_4_19 = 0;
+    Real out_5_0 = k_14 * y_6;
+    Real out_5_1 = -k_3 * y_5;
+    Real out_5_2 = 0;
+    Real out_5_3 = 0;
+    Real out_5_4 = -k_3 * y_2;
+    Real out_5_5 = k_6 * y_7 + k_8 * y_9 + k_14 * y_1 + k_20 * y_17;
+    Real out_5_6 = k_6 * y_6;
+    Real out_5_7 = 0;
+    Real out_5_8 = k_8 * y_6;
+    Real out_5_9 = 0;
+    Real out_5_10 = 0;
+    Real out_5_11 = 0;
+    Real out_5_12 = 0;
+    Real out_5_13 = 0;
+    Real out_5_14 = 0;
+    Real out_5_15 = -2 * k_18;
+    Real out_5_16 = k_20 * y_6;
+    Real out_5_17 = 0;
+    Real out_5_18 = 0;
+    Real out_5_19 = 0;
+    Real out_6_0 = 0;
+    Real out_6_1 = 0;
+    Real out_6_2 = 0;
+    Real out_6_3 = 0;
+    Real out_6_4 = 0;
+    Real out_6_5 = k_6 * y_7;
+    Real out_6_6 = k_4 + k_5 + k_6 * y_6;
+    Real out_6_7 = 0;
+    Real out_6_8 = 0;
+    Real out_6_9 = 0;
+    Real out_6_10 = 0;
+    Real out_6_11 = 0;
+    Real out_6_12 = 0;
+    Real out_6_13 = -k_13;
+    Real out_6_14 = 0;
+    Real out_6_15 = 0;
+    Real out_6_16 = 0;
+    Real out_6_17 = 0;
+    Real out_6_18 = 0;
+    Real out_6_19 = 0;
+    Real out_7_0 = 0;
+    Real out_7_1 = 0;
+    Real out_7_2 = 0;
+    Real out_7_3 = 0;
+    Real out_7_4 = 0;
+    Real out_7_5 = -k_6 * y_7;
+    Real out_7_6 = -k_4 - k_5 - k_6 * y_6;
+    Real out_7_7 = 0;
+    Real out_7_8 = -k_7;
+    Real out_7_9 = 0;
+    Real out_7_10 = 0;
+    Real out_7_11 = 0;
+    Real out_7_12 = 0;
+    Real out_7_13 = 0;
+    Real out_7_14 = 0;
+    Real out_7_15 = 0;
+    Real out_7_16 = 0;
+    Real out_7_17 = 0;
+    Real out_7_18 = 0;
+    Real out_7_19 = 0;
+    Real out_8_0 = 0;
+    Real out_8_1 = 0;
+    Real out_8_2 = 0;
+    Real out_8_3 = 0;
+    Real out_8_4 = 0;
+    Real out_8_5 = k_8 * y_9;
+    Real out_8_6 = 0;
+    Real out_8_7 = 0;
+    Real out_8_8 = k_7 + k_8 * y_6;
+    Real out_8_9 = 0;
+    Real out_8_10 = 0;
+    Real out_8_11 = 0;
+    Real out_8_12 = 0;
+    Real out_8_13 = 0;
+    Real out_8_14 = 0;
+    Real out_8_15 = 0;
+    Real out_8_16 = 0;
+    Real out_8_17 = 0;
+    Real out_8_18 = 0;
+    Real out_8_19 = 0;
+    Real out_9_0 = 0;
+    Real out_9_1 = k_12 * y_10 - k_9 * y_11;
+    Real out_9_2 = 0;
+    Real out_9_3 = 0;
+    Real out_9_4 = 0;
+    Real out_9_5 = 0;
+    Real out_9_6 = 0;
+    Real out_9_7 = 0;
+    Real out_9_8 = -k_7;
+    Real out_9_9 = k_12 * y_2;
+    Real out_9_10 = -k_9 * y_2;
+    Real out_9_11 = 0;
+    Real out_9_12 = 0;
+    Real out_9_13 = 0;
+    Real out_9_14 = 0;
+    Real out_9_15 = 0;
+    Real out_9_16 = 0;
+    Real out_9_17 = 0;
+    Real out_9_18 = 0;
+    Real out_9_19 = 0;
+    Real out_10_0 = k_10 * y_11;
+    Real out_10_1 = k_9 * y_11;
+    Real out_10_2 = 0;
+    Real out_10_3 = 0;
+    Real out_10_4 = 0;
+    Real out_10_5 = -k_8 * y_9;
+    Real out_10_6 = 0;
+    Real out_10_7 = 0;
+    Real out_10_8 = -k_8 * y_6;
+    Real out_10_9 = 0;
+    Real out_10_10 = k_9 * y_2 + k_10 * y_1;
+    Real out_10_11 = 0;
+    Real out_10_12 = -k_11;
+    Real out_10_13 = 0;
+    Real out_10_14 = 0;
+    Real out_10_15 = 0;
+    Real out_10_16 = 0;
+    Real out_10_17 = 0;
+    Real out_10_18 = 0;
+    Real out_10_19 = 0;
+    Real out_11_0 = 0;
+    Real out_11_1 = -k_9 * y_11;
+    Real out_11_2 = 0;
+    Real out_11_3 = 0;
+    Real out_11_4 = 0;
+    Real out_11_5 = 0;
+    Real out_11_6 = 0;
+    Real out_11_7 = 0;
+    Real out_11_8 = 0;
+    Real out_11_9 = 0;
+    Real out_11_10 = -k_9 * y_2;
+    Real out_11_11 = 0;
+    Real out_11_12 = 0;
+    Real out_11_13 = 0;
+    Real out_11_14 = 0;
+    Real out_11_15 = 0;
+    Real out_11_16 = 0;
+    Real out_11_17 = 0;
+    Real out_11_18 = 0;
+    Real out_11_19 = 0;
+    Real out_12_0 = -k_10 * y_11;
+    Real out_12_1 = 0;
+    Real out_12_2 = 0;
+    Real out_12_3 = 0;
+    Real out_12_4 = 0;
+    Real out_12_5 = 0;
+    Real out_12_6 = 0;
+    Real out_12_7 = 0;
+    Real out_12_8 = 0;
+    Real out_12_9 = 0;
+    Real out_12_10 = -k_10 * y_1;
+    Real out_12_11 = 0;
+    Real out_12_12 = k_11;
+    Real out_12_13 = 0;
+    Real out_12_14 = 0;
+    Real out_12_15 = 0;
+    Real out_12_16 = 0;
+    Real out_12_17 = 0;
+    Real out_12_18 = 0;
+    Real out_12_19 = 0;
+    Real out_13_0 = 0;
+    Real out_13_1 = -k_12 * y_10;
+    Real out_13_2 = 0;
+    Real out_13_3 = 0;
+    Real out_13_4 = 0;
+    Real out_13_5 = 0;
+    Real out_13_6 = 0;
+    Real out_13_7 = 0;
+    Real out_13_8 = 0;
+    Real out_13_9 = -k_12 * y_2;
+    Real out_13_10 = 0;
+    Real out_13_11 = 0;
+    Real out_13_12 = 0;
+    Real out_13_13 = k_13;
+    Real out_13_14 = 0;
+    Real out_13_15 = 0;
+    Real out_13_16 = 0;
+    Real out_13_17 = 0;
+    Real out_13_18 = 0;
+    Real out_13_19 = 0;
+    Real out_14_0 = -k_14 * y_6;
+    Real out_14_1 = 0;
+    Real out_14_2 = 0;
+    Real out_14_3 = 0;
+    Real out_14_4 = 0;
+    Real out_14_5 = -k_14 * y_1;
+    Real out_14_6 = 0;
+    Real out_14_7 = 0;
+    Real out_14_8 = 0;
+    Real out_14_9 = 0;
+    Real out_14_10 = 0;
+    Real out_14_11 = 0;
+    Real out_14_12 = 0;
+    Real out_14_13 = 0;
+    Real out_14_14 = 0;
+    Real out_14_15 = 0;
+    Real out_14_16 = 0;
+    Real out_14_17 = 0;
+    Real out_14_18 = 0;
+    Real out_14_19 = 0;
+    Real out_15_0 = 0;
+    Real out_15_1 = 0;
+    Real out_15_2 = 0;
+    Real out_15_3 = -k_16;
+    Real out_15_4 = 0;
+    Real out_15_5 = 0;
+    Real out_15_6 = 0;
+    Real out_15_7 = 0;
+    Real out_15_8 = 0;
+    Real out_15_9 = 0;
+    Real out_15_10 = 0;
+    Real out_15_11 = 0;
+    Real out_15_12 = 0;
+    Real out_15_13 = 0;
+    Real out_15_14 = 0;
+    Real out_15_15 = k_18 + k_19;
+    Real out_15_16 = 0;
+    Real out_15_17 = 0;
+    Real out_15_18 = 0;
+    Real out_15_19 = 0;
+    Real out_16_0 = 0;
+    Real out_16_1 = 0;
+    Real out_16_2 = 0;
+    Real out_16_3 = 0;
+    Real out_16_4 = 0;
+    Real out_16_5 = k_20 * y_17;
+    Real out_16_6 = 0;
+    Real out_16_7 = 0;
+    Real out_16_8 = 0;
+    Real out_16_9 = 0;
+    Real out_16_10 = 0;
+    Real out_16_11 = 0;
+    Real out_16_12 = 0;
+    Real out_16_13 = 0;
+    Real out_16_14 = 0;
+    Real out_16_15 = 0;
+    Real out_16_16 = k_20 * y_6;
+    Real out_16_17 = 0;
+    Real out_16_18 = 0;
+    Real out_16_19 = 0;
+    Real out_17_0 = 0;
+    Real out_17_1 = 0;
+    Real out_17_2 = 0;
+    Real out_17_3 = 0;
+    Real out_17_4 = 0;
+    Real out_17_5 = -k_20 * y_17;
+    Real out_17_6 = 0;
+    Real out_17_7 = 0;
+    Real out_17_8 = 0;
+    Real out_17_9 = 0;
+    Real out_17_10 = 0;
+    Real out_17_11 = 0;
+    Real out_17_12 = 0;
+    Real out_17_13 = 0;
+    Real out_17_14 = 0;
+    Real out_17_15 = 0;
+    Real out_17_16 = -k_20 * y_6;
+    Real out_17_17 = 0;
+    Real out_17_18 = 0;
+    Real out_17_19 = 0;
+    Real out_18_0 = k_24 * y_19 - k_23 * y_4;
+    Real out_18_1 = 0;
+    Real out_18_2 = 0;
+    Real out_18_3 = -k_23 * y_1;
+    Real out_18_4 = 0;
+    Real out_18_5 = 0;
+    Real out_18_6 = 0;
+    Real out_18_7 = 0;
+    Real out_18_8 = 0;
+    Real out_18_9 = 0;
+    Real out_18_10 = 0;
+    Real out_18_11 = 0;
+    Real out_18_12 = 0;
+    Real out_18_13 = 0;
+    Real out_18_14 = 0;
+    Real out_18_15 = 0;
+    Real out_18_16 = 0;
+    Real out_18_17 = 0;
+    Real out_18_18 = k_21 + k_22 + k_24 * y_1;
+    Real out_18_19 = -k_25;
+    Real out_19_0 = -k_24 * y_19;
+    Real out_19_1 = 0;
+    Real out_19_2 = 0;
+    Real out_19_3 = 0;
+    Real out_19_4 = 0;
+    Real out_19_5 = 0;
+    Real out_19_6 = 0;
+    Real out_19_7 = 0;
+    Real out_19_8 = 0;
+    Real out_19_9 = 0;
+    Real out_19_10 = 0;
+    Real out_19_11 = 0;
+    Real out_19_12 = 0;
+    Real out_19_13 = 0;
+    Real out_19_14 = 0;
+    Real out_19_15 = 0;
+    Real out_19_16 = 0;
+    Real out_19_17 = 0;
+    Real out_19_18 = -k_24 * y_1;
+    Real out_19_19 = k_25;
+
+    // Return results
+    MatrixJF out_JF_x;
+    out_JF_x <<
+      out_0_0, out_0_1, out_0_2, out_0_3, out_0_4, out_0_5, out_0_6, out_0_7, out_0_8, out_0_9, out_0_10, out_0_11, out_0_12, out_0_13, out_0_14, out_0_15, out_0_16, out_0_17, out_0_18, out_0_19, out_1_0, out_1_1, out_1_2, out_1_3, out_1_4, out_1_5, out_1_6, out_1_7, out_1_8, out_1_9, out_1_10, out_1_11, out_1_12, out_1_13, out_1_14, out_1_15, out_1_16, out_1_17, out_1_18, out_1_19, out_2_0, out_2_1, out_2_2, out_2_3, out_2_4, out_2_5, out_2_6, out_2_7, out_2_8, out_2_9, out_2_10, out_2_11, out_2_12, out_2_13, out_2_14, out_2_15, out_2_16, out_2_17, out_2_18, out_2_19, out_3_0, out_3_1, out_3_2, out_3_3, out_3_4, out_3_5, out_3_6, out_3_7, out_3_8, out_3_9, out_3_10, out_3_11, out_3_12, out_3_13, out_3_14, out_3_15, out_3_16, out_3_17, out_3_18, out_3_19, out_4_0, out_4_1, out_4_2, out_4_3, out_4_4, out_4_5, out_4_6, out_4_7, out_4_8, out_4_9, out_4_10, out_4_11, out_4_12, out_4_13, out_4_14, out_4_15, out_4_16, out_4_17, out_4_18, out_4_19, out_5_0, out_5_1, out_5_2, out_5_3, out_5_4, out_5_5, out_5_6, out_5_7, out_5_8, out_5_9, out_5_10, out_5_11, out_5_12, out_5_13, out_5_14, out_5_15, out_5_16, out_5_17, out_5_18, out_5_19, out_6_0, out_6_1, out_6_2, out_6_3, out_6_4, out_6_5, out_6_6, out_6_7, out_6_8, out_6_9, out_6_10, out_6_11, out_6_12, out_6_13, out_6_14, out_6_15, out_6_16, out_6_17, out_6_18, out_6_19, out_7_0, out_7_1, out_7_2, out_7_3, out_7_4, out_7_5, out_7_6, out_7_7, out_7_8, out_7_9, out_7_10, out_7_11, out_7_12, out_7_13, out_7_14, out_7_15, out_7_16, out_7_17, out_7_18, out_7_19, out_8_0, out_8_1, out_8_2, out_8_3, out_8_4, out_8_5, out_8_6, out_8_7, out_8_8, out_8_9, out_8_10, out_8_11, out_8_12, out_8_13, out_8_14, out_8_15, out_8_16, out_8_17, out_8_18, out_8_19, out_9_0, out_9_1, out_9_2, out_9_3, out_9_4, out_9_5, out_9_6, out_9_7, out_9_8, out_9_9, out_9_10, out_9_11, out_9_12, out_9_13, out_9_14, out_9_15, out_9_16, out_9_17, out_9_18, out_9_19, out_10_0, out_10_1, out_10_2, out_10_3, out_10_4, out_10_5, out_10_6, out_10_7, out_10_8, out_10_9, out_10_10, out_10_11, out_10_12, out_10_13, out_10_14, out_10_15, out_10_16, out_10_17, out_10_18, out_10_19, out_11_0, out_11_1, out_11_2, out_11_3, out_11_4, out_11_5, out_11_6, out_11_7, out_11_8, out_11_9, out_11_10, out_11_11, out_11_12, out_11_13, out_11_14, out_11_15, out_11_16, out_11_17, out_11_18, out_11_19, out_12_0, out_12_1, out_12_2, out_12_3, out_12_4, out_12_5, out_12_6, out_12_7, out_12_8, out_12_9, out_12_10, out_12_11, out_12_12, out_12_13, out_12_14, out_12_15, out_12_16, out_12_17, out_12_18, out_12_19, out_13_0, out_13_1, out_13_2, out_13_3, out_13_4, out_13_5, out_13_6, out_13_7, out_13_8, out_13_9, out_13_10, out_13_11, out_13_12, out_13_13, out_13_14, out_13_15, out_13_16, out_13_17, out_13_18, out_13_19, out_14_0, out_14_1, out_14_2, out_14_3, out_14_4, out_14_5, out_14_6, out_14_7, out_14_8, out_14_9, out_14_10, out_14_11, out_14_12, out_14_13, out_14_14, out_14_15, out_14_16, out_14_17, out_14_18, out_14_19, out_15_0, out_15_1, out_15_2, out_15_3, out_15_4, out_15_5, out_15_6, out_15_7, out_15_8, out_15_9, out_15_10, out_15_11, out_15_12, out_15_13, out_15_14, out_15_15, out_15_16, out_15_17, out_15_18, out_15_19, out_16_0, out_16_1, out_16_2, out_16_3, out_16_4, out_16_5, out_16_6, out_16_7, out_16_8, out_16_9, out_16_10, out_16_11, out_16_12, out_16_13, out_16_14, out_16_15, out_16_16, out_16_17, out_16_18, out_16_19, out_17_0, out_17_1, out_17_2, out_17_3, out_17_4, out_17_5, out_17_6, out_17_7, out_17_8, out_17_9, out_17_10, out_17_11, out_17_12, out_17_13, out_17_14, out_17_15, out_17_16, out_17_17, out_17_18, out_17_19, out_18_0, out_18_1, out_18_2, out_18_3, out_18_4, out_18_5, out_18_6, out_18_7, out_18_8, out_18_9, out_18_10, out_18_11, out_18_12, out_18_13, out_18_14, out_18_15, out_18_16, out_18_17, out_18_18, out_18_19, out_19_0, out_19_1, out_19_2, out_19_3, out_19_4, out_19_5, out_19_6, out_19_7, out_19_8, out_19_9, out_19_10, out_19_11, out_19_12, out_19_13, out_19_14, out_19_15, out_19_16, out_19_17, out_19_18, out_19_19;
+    return out_JF_x;
+  }
+  // Evaluate the Jacobian of F with respect to x_dot.
+  MatrixJF JF_x_dot(VectorF const & /*in_0*/, VectorF const & /*in_1*/, Real /*in_2*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0_0 = 1;
+    Real out_0_1 = 0;
+    Real out_0_2 = 0;
+    Real out_0_3 = 0;
+    Real out_0_4 = 0;
+    Real out_0_5 = 0;
+    Real out_0_6 = 0;
+    Real out_0_7 = 0;
+    Real out_0_8 = 0;
+    Real out_0_9 = 0;
+    Real out_0_10 = 0;
+    Real out_0_11 = 0;
+    Real out_0_12 = 0;
+    Real out_0_13 = 0;
+    Real out_0_14 = 0;
+    Real out_0_15 = 0;
+    Real out_0_16 = 0;
+    Real out_0_17 = 0;
+    Real out_0_18 = 0;
+    Real out_0_19 = 0;
+    Real out_1_0 = 0;
+    Real out_1_1 = 1;
+    Real out_1_2 = 0;
+    Real out_1_3 = 0;
+    Real out_1_4 = 0;
+    Real out_1_5 = 0;
+    Real out_1_6 = 0;
+    Real out_1_7 = 0;
+    Real out_1_8 = 0;
+    Real out_1_9 = 0;
+    Real out_1_10 = 0;
+    Real out_1_11 = 0;
+    Real out_1_12 = 0;
+    Real out_1_13 = 0;
+    Real out_1_14 = 0;
+    Real out_1_15 = 0;
+    Real out_1_16 = 0;
+    Real out_1_17 = 0;
+    Real out_1_18 = 0;
+    Real out_1_19 = 0;
+    Real out_2_0 = 0;
+    Real out_2_1 = 0;
+    Real out_2_2 = 1;
+    Real out_2_3 = 0;
+    Real out_2_4 = 0;
+    Real out_2_5 = 0;
+    Real out_2_6 = 0;
+    Real out_2_7 = 0;
+    Real out_2_8 = 0;
+    Real out_2_9 = 0;
+    Real out_2_10 = 0;
+    Real out_2_11 = 0;
+    Real out_2_12 = 0;
+    Real out_2_13 = 0;
+    Real out_2_14 = 0;
+    Real out_2_15 = 0;
+    Real out_2_16 = 0;
+    Real out_2_17 = 0;
+    Real out_2_18 = 0;
+    Real out_2_19 = 0;
+    Real out_3_0 = 0;
+    Real out_3_1 = 0;
+    Real out_3_2 = 0;
+    Real out_3_3 = 1;
+    Real out_3_4 = 0;
+    Real out_3_5 = 0;
+    Real out_3_6 = 0;
+    Real out_3_7 = 0;
+    Real out_3_8 = 0;
+    Real out_3_9 = 0;
+    Real out_3_10 = 0;
+    Real out_3_11 = 0;
+    Real out_3_12 = 0;
+    Real out_3_13 = 0;
+    Real out_3_14 = 0;
+    Real out_3_15 = 0;
+    Real out_3_16 = 0;
+    Real out_3_17 = 0;
+    Real out_3_18 = 0;
+    Real out_3_19 = 0;
+    Real out_4_0 = 0;
+    Real out_4_1 = 0;
+    Real out_4_2 = 0;
+    Real out_4_3 = 0;
+    Real out_4_4 = 1;
+    Real out_4_5 = 0;
+    Real out_4_6 = 0;
+    Real out_4_7 = 0;
+    Real out_4_8 = 0;
+    Real out_4_9 = 0;
+    Real out_4_10 = 0;
+    Real out_4_11 = 0;
+    Real out_4_12 = 0;
+    Real out_4_13 = 0;
+    Real out_4_14 = 0;
+    Real out_4_15 = 0;
+    Real out_4_16 = 0;
+    Real out_4_17 = 0;
+    Real out_4_18 = 0;
+    Real out_4_19 = 0;
+    Real out_5_0 = 0;
+    Real out_5_1 = 0;
+    Real out_5_2 = 0;
+    Real out_5_3 = 0;
+    Real out_5_4 = 0;
+    Real out_5_5 = 1;
+    Real out_5_6 = 0;
+    Real out_5_7 = 0;
+    Real out_5_8 = 0;
+    Real out_5_9 = 0;
+    Real out_5_10 = 0;
+    Real out_5_11 = 0;
+    Real out_5_12 = 0;
+    Real out_5_13 = 0;
+    Real out_5_14 = 0;
+    Real out_5_15 = 0;
+    Real out_5_16 = 0;
+    Real out_5_17 = 0;
+    Real out_5_18 = 0;
+    Real out_5_19 = 0;
+    Real out_6_0 = 0;
+    Real out_6_1 = 0;
+    Real out_6_2 = 0;
+    Real out_6_3 = 0;
+    Real out_6_4 = 0;
+    Real out_6_5 = 0;
+    Real out_6_6 = 1;
+    Real out_6_7 = 0;
+    Real out_6_8 = 0;
+    Real out_6_9 = 0;
+    Real out_6_10 = 0;
+    Real out_6_11 = 0;
+    Real out_6_12 = 0;
+    Real out_6_13 = 0;
+    Real out_6_14 = 0;
+    Real out_6_15 = 0;
+    Real out_6_16 = 0;
+    Real out_6_17 = 0;
+    Real out_6_18 = 0;
+    Real out_6_19 = 0;
+    Real out_7_0 = 0;
+    Real out_7_1 = 0;
+    Real out_7_2 = 0;
+    Real out_7_3 = 0;
+    Real out_7_4 = 0;
+    Real out_7_5 = 0;
+    Real out_7_6 = 0;
+    Real out_7_7 = 1;
+    Real out_7_8 = 0;
+    Real out_7_9 = 0;
+    Real out_7_10 = 0;
+    Real out_7_11 = 0;
+    Real out_7_12 = 0;
+    Real out_7_13 = 0;
+    Real out_7_14 = 0;
+    Real out_7_15 = 0;
+    Real out_7_16 = 0;
+    Real out_7_17 = 0;
+    Real out_7_18 = 0;
+    Real out_7_19 = 0;
+    Real out_8_0 = 0;
+    Real out_8_1 = 0;
+    Real out_8_2 = 0;
+    Real out_8_3 = 0;
+    Real out_8_4 = 0;
+    Real out_8_5 = 0;
+    Real out_8_6 = 0;
+    Real out_8_7 = 0;
+    Real out_8_8 = 1;
+    Real out_8_9 = 0;
+    Real out_8_10 = 0;
+    Real out_8_11 = 0;
+    Real out_8_12 = 0;
+    Real out_8_13 = 0;
+    Real out_8_14 = 0;
+    Real out_8_15 = 0;
+    Real out_8_16 = 0;
+    Real out_8_17 = 0;
+    Real out_8_18 = 0;
+    Real out_8_19 = 0;
+    Real out_9_0 = 0;
+    Real out_9_1 = 0;
+    Real out_9_2 = 0;
+    Real out_9_3 = 0;
+    Real out_9_4 = 0;
+    Real out_9_5 = 0;
+    Real out_9_6 = 0;
+    Real out_9_7 = 0;
+    Real out_9_8 = 0;
+    Real out_9_9 = 1;
+    Real out_9_10 = 0;
+    Real out_9_11 = 0;
+    Real out_9_12 = 0;
+    Real out_9_13 = 0;
+    Real out_9_14 = 0;
+    Real out_9_15 = 0;
+    Real out_9_16 = 0;
+    Real out_9_17 = 0;
+    Real out_9_18 = 0;
+    Real out_9_19 = 0;
+    Real out_10_0 = 0;
+    Real out_10_1 = 0;
+    Real out_10_2 = 0;
+    Real out_10_3 = 0;
+    Real out_10_4 = 0;
+    Real out_10_5 = 0;
+    Real out_10_6 = 0;
+    Real out_10_7 = 0;
+    Real out_10_8 = 0;
+    Real out_10_9 = 0;
+    Real out_10_10 = 1;
+    Real out_10_11 = 0;
+    Real out_10_12 = 0;
+    Real out_10_13 = 0;
+    Real out_10_14 = 0;
+    Real out_10_15 = 0;
+    Real out_10_16 = 0;
+    Real out_10_17 = 0;
+    Real out_10_18 = 0;
+    Real out_10_19 = 0;
+    Real out_11_0 = 0;
+    Real out_11_1 = 0;
+    Real out_11_2 = 0;
+    Real out_11_3 = 0;
+    Real out_11_4 = 0;
+    Real out_11_5 = 0;
+    Real out_11_6 = 0;
+    Real out_11_7 = 0;
+    Real out_11_8 = 0;
+    Real out_11_9 = 0;
+    Real out_11_10 = 0;
+    Real out_11_11 = 1;
+    Real out_11_12 = 0;
+    Real out_11_13 = 0;
+    Real out_11_14 = 0;
+    Real out_11_15 = 0;
+    Real out_11_16 = 0;
+    Real out_11_17 = 0;
+    Real out_11_18 = 0;
+    Real out_11_19 = 0;
+    Real out_12_0 = 0;
+    Real out_12_1 = 0;
+    Real out_12_2 = 0;
+    Real out_12_3 = 0;
+    Real out_12_4 = 0;
+    Real out_12_5 = 0;
+    Real out_12_6 = 0;
+    Real out_12_7 = 0;
+    Real out_12_8 = 0;
+    Real out_12_9 = 0;
+    Real out_12_10 = 0;
+    Real out_12_11 = 0;
+    Real out_12_12 = 1;
+    Real out_12_13 = 0;
+    Real out_12_14 = 0;
+    Real out_12_15 = 0;
+    Real out_12_16 = 0;
+    Real out_12_17 = 0;
+    Real out_12_18 = 0;
+    Real out_12_19 = 0;
+    Real out_13_0 = 0;
+    Real out_13_1 = 0;
+    Real out_13_2 = 0;
+    Real out_13_3 = 0;
+    Real out_13_4 = 0;
+    Real out_13_5 = 0;
+    Real out_13_6 = 0;
+    Real out_13_7 = 0;
+    Real out_13_8 = 0;
+    Real out_13_9 = 0;
+    Real out_13_10 = 0;
+    Real out_13_11 = 0;
+    Real out_13_12 = 0;
+    Real out_13_13 = 1;
+    Real out_13_14 = 0;
+    Real out_13_15 = 0;
+    Real out_13_16 = 0;
+    Real out_13_17 = 0;
+    Real out_13_18 = 0;
+    Real out_13_19 = 0;
+    Real out_14_0 = 0;
+    Real out_14_1 = 0;
+    Real out_14_2 = 0;
+    Real out_14_3 = 0;
+    Real out_14_4 = 0;
+    Real out_14_5 = 0;
+    Real out_14_6 = 0;
+    Real out_14_7 = 0;
+    Real out_14_8 = 0;
+    Real out_14_9 = 0;
+    Real out_14_10 = 0;
+    Real out_14_11 = 0;
+    Real out_14_12 = 0;
+    Real out_14_13 = 0;
+    Real out_14_14 = 1;
+    Real out_14_15 = 0;
+    Real out_14_16 = 0;
+    Real out_14_17 = 0;
+    Real out_14_18 = 0;
+    Real out_14_19 = 0;
+    Real out_15_0 = 0;
+    Real out_15_1 = 0;
+    Real out_15_2 = 0;
+    Real out_15_3 = 0;
+    Real out_15_4 = 0;
+    Real out_15_5 = 0;
+    Real out_15_6 = 0;
+    Real out_15_7 = 0;
+    Real out_15_8 = 0;
+    Real out_15_9 = 0;
+    Real out_15_10 = 0;
+    Real out_15_11 = 0;
+    Real out_15_12 = 0;
+    Real out_15_13 = 0;
+    Real out_15_14 = 0;
+    Real out_15_15 = 1;
+    Real out_15_16 = 0;
+    Real out_15_17 = 0;
+    Real out_15_18 = 0;
+    Real out_15_19 = 0;
+    Real out_16_0 = 0;
+    Real out_16_1 = 0;
+    Real out_16_2 = 0;
+    Real out_16_3 = 0;
+    Real out_16_4 = 0;
+    Real out_16_5 = 0;
+    Real out_16_6 = 0;
+    Real out_16_7 = 0;
+    Real out_16_8 = 0;
+    Real out_16_9 = 0;
+    Real out_16_10 = 0;
+    Real out_16_11 = 0;
+    Real out_16_12 = 0;
+    Real out_16_13 = 0;
+    Real out_16_14 = 0;
+    Real out_16_15 = 0;
+    Real out_16_16 = 1;
+    Real out_16_17 = 0;
+    Real out_16_18 = 0;
+    Real out_16_19 = 0;
+    Real out_17_0 = 0;
+    Real out_17_1 = 0;
+    Real out_17_2 = 0;
+    Real out_17_3 = 0;
+    Real out_17_4 = 0;
+    Real out_17_5 = 0;
+    Real out_17_6 = 0;
+    Real out_17_7 = 0;
+    Real out_17_8 = 0;
+    Real out_17_9 = 0;
+    Real out_17_10 = 0;
+    Real out_17_11 = 0;
+    Real out_17_12 = 0;
+    Real out_17_13 = 0;
+    Real out_17_14 = 0;
+    Real out_17_15 = 0;
+    Real out_17_16 = 0;
+    Real out_17_17 = 1;
+    Real out_17_18 = 0;
+    Real out_17_19 = 0;
+    Real out_18_0 = 0;
+    Real out_18_1 = 0;
+    Real out_18_2 = 0;
+    Real out_18_3 = 0;
+    Real out_18_4 = 0;
+    Real out_18_5 = 0;
+    Real out_18_6 = 0;
+    Real out_18_7 = 0;
+    Real out_18_8 = 0;
+    Real out_18_9 = 0;
+    Real out_18_10 = 0;
+    Real out_18_11 = 0;
+    Real out_18_12 = 0;
+    Real out_18_13 = 0;
+    Real out_18_14 = 0;
+    Real out_18_15 = 0;
+    Real out_18_16 = 0;
+    Real out_18_17 = 0;
+    Real out_18_18 = 1;
+    Real out_18_19 = 0;
+    Real out_19_0 = 0;
+    Real out_19_1 = 0;
+    Real out_19_2 = 0;
+    Real out_19_3 = 0;
+    Real out_19_4 = 0;
+    Real out_19_5 = 0;
+    Real out_19_6 = 0;
+    Real out_19_7 = 0;
+    Real out_19_8 = 0;
+    Real out_19_9 = 0;
+    Real out_19_10 = 0;
+    Real out_19_11 = 0;
+    Real out_19_12 = 0;
+    Real out_19_13 = 0;
+    Real out_19_14 = 0;
+    Real out_19_15 = 0;
+    Real out_19_16 = 0;
+    Real out_19_17 = 0;
+    Real out_19_18 = 0;
+    Real out_19_19 = 1;
+
+    // Return results
+    MatrixJF out_JF_x_dot;
+    out_JF_x_dot <<
+      out_0_0, out_0_1, out_0_2, out_0_3, out_0_4, out_0_5, out_0_6, out_0_7, out_0_8, out_0_9, out_0_10, out_0_11, out_0_12, out_0_13, out_0_14, out_0_15, out_0_16, out_0_17, out_0_18, out_0_19, out_1_0, out_1_1, out_1_2, out_1_3, out_1_4, out_1_5, out_1_6, out_1_7, out_1_8, out_1_9, out_1_10, out_1_11, out_1_12, out_1_13, out_1_14, out_1_15, out_1_16, out_1_17, out_1_18, out_1_19, out_2_0, out_2_1, out_2_2, out_2_3, out_2_4, out_2_5, out_2_6, out_2_7, out_2_8, out_2_9, out_2_10, out_2_11, out_2_12, out_2_13, out_2_14, out_2_15, out_2_16, out_2_17, out_2_18, out_2_19, out_3_0, out_3_1, out_3_2, out_3_3, out_3_4, out_3_5, out_3_6, out_3_7, out_3_8, out_3_9, out_3_10, out_3_11, out_3_12, out_3_13, out_3_14, out_3_15, out_3_16, out_3_17, out_3_18, out_3_19, out_4_0, out_4_1, out_4_2, out_4_3, out_4_4, out_4_5, out_4_6, out_4_7, out_4_8, out_4_9, out_4_10, out_4_11, out_4_12, out_4_13, out_4_14, out_4_15, out_4_16, out_4_17, out_4_18, out_4_19, out_5_0, out_5_1, out_5_2, out_5_3, out_5_4, out_5_5, out_5_6, out_5_7, out_5_8, out_5_9, out_5_10, out_5_11, out_5_12, out_5_13, out_5_14, out_5_15, out_5_16, out_5_17, out_5_18, out_5_19, out_6_0, out_6_1, out_6_2, out_6_3, out_6_4, out_6_5, out_6_6, out_6_7, out_6_8, out_6_9, out_6_10, out_6_11, out_6_12, out_6_13, out_6_14, out_6_15, out_6_16, out_6_17, out_6_18, out_6_19, out_7_0, out_7_1, out_7_2, out_7_3, out_7_4, out_7_5, out_7_6, out_7_7, out_7_8, out_7_9, out_7_10, out_7_11, out_7_12, out_7_13, out_7_14, out_7_15, out_7_16, out_7_17, out_7_18, out_7_19, out_8_0, out_8_1, out_8_2, out_8_3, out_8_4, out_8_5, out_8_6, out_8_7, out_8_8, out_8_9, out_8_10, out_8_11, out_8_12, out_8_13, out_8_14, out_8_15, out_8_16, out_8_17, out_8_18, out_8_19, out_9_0, out_9_1, out_9_2, out_9_3, out_9_4, out_9_5, out_9_6, out_9_7, out_9_8, out_9_9, out_9_10, out_9_11, out_9_12, out_9_13, out_9_14, out_9_15, out_9_16, out_9_17, out_9_18, out_9_19, out_10_0, out_10_1, out_10_2, out_10_3, out_10_4, out_10_5, out_10_6, out_10_7, out_10_8, out_10_9, out_10_10, out_10_11, out_10_12, out_10_13, out_10_14, out_10_15, out_10_16, out_10_17, out_10_18, out_10_19, out_11_0, out_11_1, out_11_2, out_11_3, out_11_4, out_11_5, out_11_6, out_11_7, out_11_8, out_11_9, out_11_10, out_11_11, out_11_12, out_11_13, out_11_14, out_11_15, out_11_16, out_11_17, out_11_18, out_11_19, out_12_0, out_12_1, out_12_2, out_12_3, out_12_4, out_12_5, out_12_6, out_12_7, out_12_8, out_12_9, out_12_10, out_12_11, out_12_12, out_12_13, out_12_14, out_12_15, out_12_16, out_12_17, out_12_18, out_12_19, out_13_0, out_13_1, out_13_2, out_13_3, out_13_4, out_13_5, out_13_6, out_13_7, out_13_8, out_13_9, out_13_10, out_13_11, out_13_12, out_13_13, out_13_14, out_13_15, out_13_16, out_13_17, out_13_18, out_13_19, out_14_0, out_14_1, out_14_2, out_14_3, out_14_4, out_14_5, out_14_6, out_14_7, out_14_8, out_14_9, out_14_10, out_14_11, out_14_12, out_14_13, out_14_14, out_14_15, out_14_16, out_14_17, out_14_18, out_14_19, out_15_0, out_15_1, out_15_2, out_15_3, out_15_4, out_15_5, out_15_6, out_15_7, out_15_8, out_15_9, out_15_10, out_15_11, out_15_12, out_15_13, out_15_14, out_15_15, out_15_16, out_15_17, out_15_18, out_15_19, out_16_0, out_16_1, out_16_2, out_16_3, out_16_4, out_16_5, out_16_6, out_16_7, out_16_8, out_16_9, out_16_10, out_16_11, out_16_12, out_16_13, out_16_14, out_16_15, out_16_16, out_16_17, out_16_18, out_16_19, out_17_0, out_17_1, out_17_2, out_17_3, out_17_4, out_17_5, out_17_6, out_17_7, out_17_8, out_17_9, out_17_10, out_17_11, out_17_12, out_17_13, out_17_14, out_17_15, out_17_16, out_17_17, out_17_18, out_17_19, out_18_0, out_18_1, out_18_2, out_18_3, out_18_4, out_18_5, out_18_6, out_18_7, out_18_8, out_18_9, out_18_10, out_18_11, out_18_12, out_18_13, out_18_14, out_18_15, out_18_16, out_18_17, out_18_18, out_18_19, out_19_0, out_19_1, out_19_2, out_19_3, out_19_4, out_19_5, out_19_6, out_19_7, out_19_8, out_19_9, out_19_10, out_19_11, out_19_12, out_19_13, out_19_14, out_19_15, out_19_16, out_19_17, out_19_18, out_19_19;
+    return out_JF_x_dot;
+  }
+
+  // Calculate the vector h of the invariants.
+  VectorH h(VectorF const & /*in_0*/, Real /*in_1*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    // Nothing to evaluate
+
+    // Return results
+    VectorH out_h;
+    out_h.setZero();
+    return out_h;
+  }
+
+  // Calculate the Jacobian of h with respect to x.
+  MatrixJH Jh_x(VectorF const & /*in_0*/, Real /*in_1*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    // Nothing to evaluate
+
+    // Return results
+    MatrixJH out_Jh_x;
+    out_Jh_x.setZero();
+    return out_Jh_x;
+  }
+
+  // Check if the system is in the defined domain.
+  bool in_domain(VectorF const &/*x*/, Real /*t*/) const override {return true;}
+
+  // Return the initial integration time
+  Real t_ini() const {return 0.;}
+
+  // Return the final integration time
+  Real t_end() const {return 60.0;}
+
+  // Evaluate the initial conditions.
+  VectorF ics() const
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0 = 0.0e0;
+    Real out_1 = 0.2e0;
+    Real out_2 = 0.0e0;
+    Real out_3 = 0.4e-1;
+    Real out_4 = 0.0e0;
+    Real out_5 = 0.0e0;
+    Real out_6 = 0.1e0;
+    Real out_7 = 0.3e0;
+    Real out_8 = 0.1e-1;
+    Real out_9 = 0.0e0;
+    Real out_10 = 0.0e0;
+    Real out_11 = 0.0e0;
+    Real out_12 = 0.0e0;
+    Real out_13 = 0.0e0;
+    Real out_14 = 0.0e0;
+    Real out_15 = 0.0e0;
+    Real out_16 = 0.7e-2;
+    Real out_17 = 0.0e0;
+    Real out_18 = 0.0e0;
+    Real out_19 = 0.0e0;
+
+    // Return results
+    VectorF out_ics;
+    out_ics <<
+      out_0, out_1, out_2, out_3, out_4, out_5, out_6, out_7, out_8, out_9, out_10, out_11, out_12, out_13, out_14, out_15, out_16, out_17, out_18, out_19;
+    return out_ics;
+  }
+
+}; // class Pollution
+
+#endif // SANDALS_MAPLE_POLLUTION_IMPLICIT_HH
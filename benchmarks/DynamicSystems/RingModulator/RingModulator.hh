@@ -0,0 +1,864 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// C++ generated code for implicit system: RingModulator
+// This file has been automatically generated by Sandals.
+// DISCLAIMER: If you need to edit it, do it wisely!
+
+#ifndef SANDALS_MAPLE_RINGMODULATOR_IMPLICIT_HH
+#define SANDALS_MAPLE_RINGMODULATOR_IMPLICIT_HH
+
+using namespace Sandals;
+using namespace std;
+
+// No class description available.
+template<typename Real = double>
+class RingModulator : public Implicit<Real, 15, 0>
+{
+  // Class data
+  Real m_C{.16e-7}; // Data variable 1
+  Real m_C_s{.2e-11}; // Data variable 2
+  Real m_C_p{.1e-7}; // Data variable 3
+  Real m_R{25000.0}; // Data variable 4
+  Real m_R_p{50.0}; // Data variable 5
+  Real m_L_h{4.45}; // Data variable 6
+  Real m_L_s1{.002}; // Data variable 7
+  Real m_L_s2{.5e-3}; // Data variable 8
+  Real m_L_s3{.5e-3}; // Data variable 9
+  Real m_R_g1{36.3}; // Data variable 10
+  Real m_R_g2{17.3}; // Data variable 11
+  Real m_R_g3{17.3}; // Data variable 12
+  Real m_R_i{50.0}; // Data variable 13
+  Real m_R_c{600.0}; // Data variable 14
+  Real m_gamma_D{.4067286402e-7}; // Data variable 15
+  Real m_delta_D{17.7493332}; // Data variable 16
+
+public:
+  using VectorF  = typename Implicit<Real, 15, 0>::VectorF;
+  using MatrixJF = typename Implicit<Real, 15, 0>::MatrixJF;
+  using VectorH  = typename Implicit<Real, 15, 0>::VectorH;
+  using MatrixJH = typename Implicit<Real, 15, 0>::MatrixJH;
+
+  // Class constructor.
+  RingModulator() : Implicit<Real, 15, 0>("RingModulator") {}
+
+  // Data variable 1 getter.
+  Real get_C() const {return this->m_C;}
+
+  // Data variable 1 setter.
+  void set_C(Real t_C) {this->m_C = t_C;}
+
+  // Data variable 2 getter.
+  Real get_C_s() const {return this->m_C_s;}
+
+  // Data variable 2 setter.
+  void set_C_s(Real t_C_s) {this->m_C_s = t_C_s;}
+
+  // Data variable 3 getter.
+  Real get_C_p() const {return this->m_C_p;}
+
+  // Data variable 3 setter.
+  void set_C_p(Real t_C_p) {this->m_C_p = t_C_p;}
+
+  // Data variable 4 getter.
+  Real get_R() const {return this->m_R;}
+
+  // Data variable 4 setter.
+  void set_R(Real t_R) {this->m_R = t_R;}
+
+  // Data variable 5 getter.
+  Real get_R_p() const {return this->m_R_p;}
+
+  // Data variable 5 setter.
+  void set_R_p(Real t_R_p) {this->m_R_p = t_R_p;}
+
+  // Data variable 6 getter.
+  Real get_L_h() const {return this->m_L_h;}
+
+  // Data variable 6 setter.
+  void set_L_h(Real t_L_h) {this->m_L_h = t_L_h;}
+
+  // Data variable 7 getter.
+  Real get_L_s1() const {return this->m_L_s1;}
+
+  // Data variable 7 setter.
+  void set_L_s1(Real t_L_s1) {this->m_L_s1 = t_L_s1;}
+
+  // Data variable 8 getter.
+  Real get_L_s2() const {return this->m_L_s2;}
+
+  // Data variable 8 setter.
+  void set_L_s2(Real t_L_s2) {this->m_L_s2 = t_L_s2;}
+
+  // Data variable 9 getter.
+  Real get_L_s3() const {return this->m_L_s3;}
+
+  // Data variable 9 setter.
+  void set_L_s3(Real t_L_s3) {this->m_L_s3 = t_L_s3;}
+
+  // Data variable 10 getter.
+  Real get_R_g1() const {return this->m_R_g1;}
+
+  // Data variable 10 setter.
+  void set_R_g1(Real t_R_g1) {this->m_R_g1 = t_R_g1;}
+
+  // Data variable 11 getter.
+  Real get_R_g2() const {return this->m_R_g2;}
+
+  // Data variable 11 setter.
+  void set_R_g2(Real t_R_g2) {this->m_R_g2 = t_R_g2;}
+
+  // Data variable 12 getter.
+  Real get_R_g3() const {return this->m_R_g3;}
+
+  // Data variable 12 setter.
+  void set_R_g3(Real t_R_g3) {this->m_R_g3 = t_R_g3;}
+
+  // Data variable 13 getter.
+  Real get_R_i() const {return this->m_R_i;}
+
+  // Data variable 13 setter.
+  void set_R_i(Real t_R_i) {this->m_R_i = t_R_i;}
+
+  // Data variable 14 getter.
+  Real get_R_c() const {return this->m_R_c;}
+
+  // Data variable 14 setter.
+  void set_R_c(Real t_R_c) {this->m_R_c = t_R_c;}
+
+  // Data variable 15 getter.
+  Real get_gamma_D() const {return this->m_gamma_D;}
+
+  // Data variable 15 setter.
+  void set_gamma_D(Real t_gamma_D) {this->m_gamma_D = t_gamma_D;}
+
+  // Data variable 16 getter.
+  Real get_delta_D() const {return this->m_delta_D;}
+
+  // Data variable 16 setter.
+  void set_delta_D(Real t_delta_D) {this->m_delta_D = t_delta_D;}
+
+  // Evaluate the function F.
+  VectorF F(VectorF const & in_0, VectorF const & in_1, Real in_2) const override
+  {
+    // Create data' aliases
+    Real const & C = this->m_C; // Data variable 1
+    Real const & C_s = this->m_C_s; // Data variable 2
+    Real const & C_p = this->m_C_p; // Data variable 3
+    Real const & R = this->m_R; // Data variable 4
+    Real const & R_p = this->m_R_p; // Data variable 5
+    Real const & L_h = this->m_L_h; // Data variable 6
+    Real const & L_s1 = this->m_L_s1; // Data variable 7
+    Real const & L_s2 = this->m_L_s2; // Data variable 8
+    Real const & L_s3 = this->m_L_s3; // Data variable 9
+    Real const & R_g1 = this->m_R_g1; // Data variable 10
+    Real const & R_g2 = this->m_R_g2; // Data variable 11
+    Real const & R_g3 = this->m_R_g3; // Data variable 12
+    Real const & R_i = this->m_R_i; // Data variable 13
+    Real const & R_c = this->m_R_c; // Data variable 14
+    Real const & gamma_D = this->m_gamma_D; // Data variable 15
+    Real const & delta_D = this->m_delta_D; // Data variable 16
+
+    // Create inputs' aliases
+    Real const & y_1 = in_0(0); // State variable 1
+    Real const & y_2 = in_0(1); // State variable 2
+    Real const & y_3 = in_0(2); // State variable 3
+    Real const & y_4 = in_0(3); // State variable 4
+    Real const & y_5 = in_0(4); // State variable 5
+    Real const & y_6 = in_0(5); // State variable 6
+    Real const & y_7 = in_0(6); // State variable 7
+    Real const & y_8 = in_0(7); // State variable 8
+    Real const & y_9 = in_0(8); // State variable 9
+    Real const & y_10 = in_0(9); // State variable 10
+    Real const & y_11 = in_0(10); // State variable 11
+    Real const & y_12 = in_0(11); // State variable 12
+    Real const & y_13 = in_0(12); // State variable 13
+    Real const & y_14 = in_0(13); // State variable 14
+    Real const & y_15 = in_0(14); // State variable 15
+    Real const & y_1_dot = in_1(0); // State variable 1 derivative
+    Real const & y_2_dot = in_1(1); // State variable 2 derivative
+    Real const & y_3_dot = in_1(2); // State variable 3 derivative
+    Real const & y_4_dot = in_1(3); // State variable 4 derivative
+    Real const & y_5_dot = in_1(4); // State variable 5 derivative
+    Real const & y_6_dot = in_1(5); // State variable 6 derivative
+    Real const & y_7_dot = in_1(6); // State variable 7 derivative
+    Real const & y_8_dot = in_1(7); // State variable 8 derivative
+    Real const & y_9_dot = in_1(8); // State variable 9 derivative
+    Real const & y_10_dot = in_1(9); // State variable 10 derivative
+    Real const & y_11_dot = in_1(10); // State variable 11 derivative
+    Real const & y_12_dot = in_1(11); // State variable 12 derivative
+    Real const & y_13_dot = in_1(12); // State variable 13 derivative
+    Real const & y_14_dot = in_1(13); // State variable 14 derivative
+    Real const & y_15_dot = in_1(14); // State variable 15 derivative
+    Real const & t = in_2; // Independent variable
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real t1 = 0.1e1 / R;
+    Real t2 = 0.3141592653589793e1 * t;
+    Real t3 = 2 * sin(20000 * t2);
+    Real t4 = t3 + y_7;
+    Real t5 = t4 + y_5;
+    Real t6 = gamma_D * exp(delta_D * (-t5 + y_3));
+    Real t7 = gamma_D * exp(delta_D * (t3 - y_3 - y_6 + y_7));
+    Real t8 = -t7;
+    Real t9 = gamma_D * exp(delta_D * (t5 + y_4));
+    Real t10 = -y_6;
+    Real t11 = gamma_D * exp(delta_D * (-t10 - t4 - y_4));
+    Real t12 = -t11 + t9;
+    Real t13 = -t6;
+    Real t14 = y_1 / 2;
+    Real t15 = y_2 / 2;
+    Real out_0 = C * y_1_dot + t1 * y_1 + y_10 / 2 - y_11 / 2 - y_14 - y_8;
+    Real out_1 = C * y_2_dot + t1 * y_2 + y_12 / 2 - y_13 / 2 - y_15 - y_9;
+    Real out_2 = C_s * y_3_dot + t6 + t8 - y_10;
+    Real out_3 = C_s * y_4_dot + t12 + y_11;
+    Real out_4 = C_s * y_5_dot + t13 + t9 - y_12;
+    Real out_5 = C_s * y_6_dot + t11 + t8 + y_13;
+    Real out_6 = C_p * y_7_dot + t12 + t13 + t7 + y_7 / R_p;
+    Real out_7 = L_h * y_8_dot + y_1;
+    Real out_8 = L_h * y_9_dot + y_2;
+    Real out_9 = L_s2 * y_10_dot + R_g2 * y_10 - t14 + y_3;
+    Real out_10 = L_s3 * y_11_dot + R_g3 * y_11 + t14 - y_4;
+    Real out_11 = L_s2 * y_12_dot + R_g2 * y_12 - t15 + y_5;
+    Real out_12 = L_s3 * y_13_dot + R_g3 * y_13 + t10 + t15;
+    Real out_13 = L_s1 * y_14_dot + R_g1 * y_14 + R_i * y_14 + y_1 - sin(2000 * t2) / 2;
+    Real out_14 = L_s1 * y_15_dot + R_c * y_15 + R_g1 * y_15 + y_2;
+
+    // Return results
+    VectorF out_F;
+    out_F <<
+      out_0, out_1, out_2, out_3, out_4, out_5, out_6, out_7, out_8, out_9, out_10, out_11, out_12, out_13, out_14;
+    return out_F;
+  }
+
+  // Evaluate the Jacobian of F with respect to x.
+  MatrixJF JF_x(VectorF const & in_0, VectorF const & /*in_1*/, Real in_2) const override
+  {
+    // Create data' aliases
+    Real const & R = this->m_R; // Data variable 4
+    Real const & R_p = this->m_R_p; // Data variable 5
+    Real const & R_g1 = this->m_R_g1; // Data variable 10
+    Real const & R_g2 = this->m_R_g2; // Data variable 11
+    Real const & R_g3 = this->m_R_g3; // Data variable 12
+    Real const & R_i = this->m_R_i; // Data variable 13
+    Real const & R_c = this->m_R_c; // Data variable 14
+    Real const & gamma_D = this->m_gamma_D; // Data variable 15
+    Real const & delta_D = this->m_delta_D; // Data variable 16
+
+    // Create inputs' aliases
+    Real const & y_3 = in_0(2); // State variable 3
+    Real const & y_4 = in_0(3); // State variable 4
+    Real const & y_5 = in_0(4); // State variable 5
+    Real const & y_6 = in_0(5); // State variable 6
+    Real const & y_7 = in_0(6); // State variable 7
+    Real const & t = in_2; // Independent variable
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real t1 = 0.1e1 / R;
+    Real t2 = 2 * sin(20000 * 0.3141592653589793e1 * t);
+    Real t3 = exp(delta_D * (t2 - y_3 - y_6 + y_7));
+    Real t4 = t2 + y_7;
+    Real t5 = t4 + y_5;
+    Real t6 = exp(delta_D * (-t5 + y_3));
+    Real t7 = delta_D * gamma_D;
+    Real t8 = t7 * (t3 + t6);
+    Real t9 = t6 * t7;
+    Real t10 = -t9;
+    Real t11 = t3 * t7;
+    Real t12 = -t8;
+    Real t13 = exp(delta_D * (t5 + y_4));
+    Real t14 = exp(delta_D * (-t4 - y_4 + y_6));
+    Real t15 = t7 * (t13 + t14);
+    Real t16 = t13 * t7;
+    Real t17 = t14 * t7;
+    Real t18 = -t17;
+    Real t19 = t7 * (t13 + t6);
+    Real t20 = t7 * (t14 + t3);
+    Real t21 = -t20;
+    Real out_0_0 = t1;
+    Real out_0_1 = 0;
+    Real out_0_2 = 0;
+    Real out_0_3 = 0;
+    Real out_0_4 = 0;
+    Real out_0_5 = 0;
+    Real out_0_6 = 0;
+    Real out_0_7 = -1;
+    Real out_0_8 = 0;
+    Real out_0_9 = 0.1e1 / 0.2e1;
+    Real out_0_10 = -0.1e1 / 0.2e1;
+    Real out_0_11 = 0;
+    Real out_0_12 = 0;
+    Real out_0_13 = -1;
+    Real out_0_14 = 0;
+    Real out_1_0 = 0;
+    Real out_1_1 = t1;
+    Real out_1_2 = 0;
+    Real out_1_3 = 0;
+    Real out_1_4 = 0;
+    Real out_1_5 = 0;
+    Real out_1_6 = 0;
+    Real out_1_7 = 0;
+    Real out_1_8 = -1;
+    Real out_1_9 = 0;
+    Real out_1_10 = 0;
+    Real out_1_11 = 0.1e1 / 0.2e1;
+    Real out_1_12 = -0.1e1 / 0.2e1;
+    Real out_1_13 = 0;
+    Real out_1_14 = -1;
+    Real out_2_0 = 0;
+    Real out_2_1 = 0;
+    Real out_2_2 = t8;
+    Real out_2_3 = 0;
+    Real out_2_4 = t10;
+    Real out_2_5 = t11;
+    Real out_2_6 = t12;
+    Real out_2_7 = 0;
+    Real out_2_8 = 0;
+    Real out_2_9 = -1;
+    Real out_2_10 = 0;
+    Real out_2_11 = 0;
+    Real out_2_12 = 0;
+    Real out_2_13 = 0;
+    Real out_2_14 = 0;
+    Real out_3_0 = 0;
+    Real out_3_1 = 0;
+    Real out_3_2 = 0;
+    Real out_3_3 = t15;
+    Real out_3_4 = t16;
+    Real out_3_5 = t18;
+    Real out_3_6 = t15;
+    Real out_3_7 = 0;
+    Real out_3_8 = 0;
+    Real out_3_9 = 0;
+    Real out_3_10 = 1;
+    Real out_3_11 = 0;
+    Real out_3_12 = 0;
+    Real out_3_13 = 0;
+    Real out_3_14 = 0;
+    Real out_4_0 = 0;
+    Real out_4_1 = 0;
+    Real out_4_2 = t10;
+    Real out_4_3 = t16;
+    Real out_4_4 = t19;
+    Real out_4_5 = 0;
+    Real out_4_6 = t19;
+    Real out_4_7 = 0;
+    Real out_4_8 = 0;
+    Real out_4_9 = 0;
+    Real out_4_10 = 0;
+    Real out_4_11 = -1;
+    Real out_4_12 = 0;
+    Real out_4_13 = 0;
+    Real out_4_14 = 0;
+    Real out_5_0 = 0;
+    Real out_5_1 = 0;
+    Real out_5_2 = t11;
+    Real out_5_3 = t18;
+    Real out_5_4 = 0;
+    Real out_5_5 = t20;
+    Real out_5_6 = t21;
+    Real out_5_7 = 0;
+    Real out_5_8 = 0;
+    Real out_5_9 = 0;
+    Real out_5_10 = 0;
+    Real out_5_11 = 0;
+    Real out_5_12 = 1;
+    Real out_5_13 = 0;
+    Real out_5_14 = 0;
+    Real out_6_0 = 0;
+    Real out_6_1 = 0;
+    Real out_6_2 = t12;
+    Real out_6_3 = t15;
+    Real out_6_4 = t19;
+    Real out_6_5 = t21;
+    Real out_6_6 = t11 + t16 + t17 + t9 + 0.1e1 / R_p;
+    Real out_6_7 = 0;
+    Real out_6_8 = 0;
+    Real out_6_9 = 0;
+    Real out_6_10 = 0;
+    Real out_6_11 = 0;
+    Real out_6_12 = 0;
+    Real out_6_13 = 0;
+    Real out_6_14 = 0;
+    Real out_7_0 = 1;
+    Real out_7_1 = 0;
+    Real out_7_2 = 0;
+    Real out_7_3 = 0;
+    Real out_7_4 = 0;
+    Real out_7_5 = 0;
+    Real out_7_6 = 0;
+    Real out_7_7 = 0;
+    Real out_7_8 = 0;
+    Real out_7_9 = 0;
+    Real out_7_10 = 0;
+    Real out_7_11 = 0;
+    Real out_7_12 = 0;
+    Real out_7_13 = 0;
+    Real out_7_14 = 0;
+    Real out_8_0 = 0;
+    Real out_8_1 = 1;
+    Real out_8_2 = 0;
+    Real out_8_3 = 0;
+    Real out_8_4 = 0;
+    Real out_8_5 = 0;
+    Real out_8_6 = 0;
+    Real out_8_7 = 0;
+    Real out_8_8 = 0;
+    Real out_8_9 = 0;
+    Real out_8_10 = 0;
+    Real out_8_11 = 0;
+    Real out_8_12 = 0;
+    Real out_8_13 = 0;
+    Real out_8_14 = 0;
+    Real out_9_0 = -0.1e1 / 0.2e1;
+    Real out_9_1 = 0;
+    Real out_9_2 = 1;
+    Real out_9_3 = 0;
+    Real out_9_4 = 0;
+    Real out_9_5 = 0;
+    Real out_9_6 = 0;
+    Real out_9_7 = 0;
+    Real out_9_8 = 0;
+    Real out_9_9 = R_g2;
+    Real out_9_10 = 0;
+    Real out_9_11 = 0;
+    Real out_9_12 = 0;
+    Real out_9_13 = 0;
+    Real out_9_14 = 0;
+    Real out_10_0 = 0.1e1 / 0.2e1;
+    Real out_10_1 = 0;
+    Real out_10_2 = 0;
+    Real out_10_3 = -1;
+    Real out_10_4 = 0;
+    Real out_10_5 = 0;
+    Real out_10_6 = 0;
+    Real out_10_7 = 0;
+    Real out_10_8 = 0;
+    Real out_10_9 = 0;
+    Real out_10_10 = R_g3;
+    Real out_10_11 = 0;
+    Real out_10_12 = 0;
+    Real out_10_13 = 0;
+    Real out_10_14 = 0;
+    Real out_11_0 = 0;
+    Real out_11_1 = -0.1e1 / 0.2e1;
+    Real out_11_2 = 0;
+    Real out_11_3 = 0;
+    Real out_11_4 = 1;
+    Real out_11_5 = 0;
+    Real out_11_6 = 0;
+    Real out_11_7 = 0;
+    Real out_11_8 = 0;
+    Real out_11_9 = 0;
+    Real out_11_10 = 0;
+    Real out_11_11 = R_g2;
+    Real out_11_12 = 0;
+    Real out_11_13 = 0;
+    Real out_11_14 = 0;
+    Real out_12_0 = 0;
+    Real out_12_1 = 0.1e1 / 0.2e1;
+    Real out_12_2 = 0;
+    Real out_12_3 = 0;
+    Real out_12_4 = 0;
+    Real out_12_5 = -1;
+    Real out_12_6 = 0;
+    Real out_12_7 = 0;
+    Real out_12_8 = 0;
+    Real out_12_9 = 0;
+    Real out_12_10 = 0;
+    Real out_12_11 = 0;
+    Real out_12_12 = R_g3;
+    Real out_12_13 = 0;
+    Real out_12_14 = 0;
+    Real out_13_0 = 1;
+    Real out_13_1 = 0;
+    Real out_13_2 = 0;
+    Real out_13_3 = 0;
+    Real out_13_4 = 0;
+    Real out_13_5 = 0;
+    Real out_13_6 = 0;
+    Real out_13_7 = 0;
+    Real out_13_8 = 0;
+    Real out_13_9 = 0;
+    Real out_13_10 = 0;
+    Real out_13_11 = 0;
+    Real out_13_12 = 0;
+    Real out_13_13 = R_g1 + R_i;
+    Real out_13_14 = 0;
+    Real out_14_0 = 0;
+    Real out_14_1 = 1;
+    Real out_14_2 = 0;
+    Real out_14_3 = 0;
+    Real out_14_4 = 0;
+    Real out_14_5 = 0;
+    Real out_14_6 = 0;
+    Real out_14_7 = 0;
+    Real out_14_8 = 0;
+    Real out_14_9 = 0;
+    Real out_14_10 = 0;
+    Real out_14_11 = 0;
+    Real out_14_12 = 0;
+    Real out_14_13 = 0;
+    Real out_14_14 = R_c + R_g1;
+
+    // Return results
+    MatrixJF out_JF_x;
+    out_JF_x <<
+      out_0_0, out_0_1, out_0_2, out_0_3, out_0_4, out_0_5, out_0_6, out_0_7, out_0_8, out_0_9, out_0_10, out_0_11, out_0_12, out_0_13, out_0_14, out_1_0, out_1_1, out_1_2, out_1_3, out_1_4, out_1_5, out_1_6, out_1_7, out_1_8, out_1_9, out_1_10, out_1_11, out_1_12, out_1_13, out_1_14, out_2_0, out_2_1, out_2_2, out_2_3, out_2_4, out_2_5, out_2_6, out_2_7, out_2_8, out_2_9, out_2_10, out_2_11, out_2_12, out_2_13, out_2_14, out_3_0, out_3_1, out_3_2, out_3_3, out_3_4, out_3_5, out_3_6, out_3_7, out_3_8, out_3_9, out_3_10, out_3_11, out_3_12, out_3_13, out_3_14, out_4_0, out_4_1, out_4_2, out_4_3, out_4_4, out_4_5, out_4_6, out_4_7, out_4_8, out_4_9, out_4_10, out_4_11, out_4_12, out_4_13, out_4_14, out_5_0, out_5_1, out_5_2, out_5_3, out_5_4, out_5_5, out_5_6, out_5_7, out_5_8, out_5_9, out_5_10, out_5_11, out_5_12, out_5_13, out_5_14, out_6_0, out_6_1, out_6_2, out_6_3, out_6_4, out_6_5, out_6_6, out_6_7, out_6_8, out_6_9, out_6_10, out_6_11, out_6_12, out_6_13, out_6_14, out_7_0, out_7_1, out_7_2, out_7_3, out_7_4, out_7_5, out_7_6, out_7_7, out_7_8, out_7_9, out_7_10, out_7_11, out_7_12, out_7_13, out_7_14, out_8_0, out_8_1, out_8_2, out_8_3, out_8_4, out_8_5, out_8_6, out_8_7, out_8_8, out_8_9, out_8_10, out_8_11, out_8_12, out_8_13, out_8_14, out_9_0, out_9_1, out_9_2, out_9_3, out_9_4, out_9_5, out_9_6, out_9_7, out_9_8, out_9_9, out_9_10, out_9_11, out_9_12, out_9_13, out_9_14, out_10_0, out_10_1, out_10_2, out_10_3, out_10_4, out_10_5, out_10_6, out_10_7, out_10_8, out_10_9, out_10_10, out_10_11, out_10_12, out_10_13, out_10_14, out_11_0, out_11_1, out_11_2, out_11_3, out_11_4, out_11_5, out_11_6, out_11_7, out_11_8, out_11_9, out_11_10, out_11_11, out_11_12, out_11_13, out_11_14, out_12_0, out_12_1, out_12_2, out_12_3, out_12_4, out_12_5, out_12_6, out_12_7, out_12_8, out_12_9, out_12_10, out_12_11, out_12_12, out_12_13, out_12_14, out_13_0, out_13_1, out_13_2, out_13_3, out_13_4, out_13_5, out_13_6, out_13_7, out_13_8, out_13_9, out_13_10, out_13_11, out_13_12, out_13_13, out_13_14, out_14_0, out_14_1, out_14_2, out_14_3, out_14_4, out_14_5, out_14_6, out_14_7, out_14_8, out_14_9, out_14_10, out_14_11, out_14_12, out_14_13, out_14_14;
+    return out_JF_x;
+  }
+  // Evaluate the Jacobian of F with respect to x_dot.
+  MatrixJF JF_x_dot(VectorF const & /*in_0*/, VectorF const & /*in_1*/, Real /*in_2*/) const override
+  {
+    // Create data' aliases
+    Real const & C = this->m_C; // Data variable 1
+    Real const & C_s = this->m_C_s; // Data variable 2
+    Real const & C_p = this->m_C_p; // Data variable 3
+    Real const & L_h = this->m_L_h; // Data variable 6
+    Real const & L_s1 = this->m_L_s1; // Data variable 7
+    Real const & L_s2 = this->m_L_s2; // Data variable 8
+    Real const & L_s3 = this->m_L_s3; // Data variable 9
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0_0 = C;
+    Real out_0_1 = 0;
+    Real out_0_2 = 0;
+    Real out_0_3 = 0;
+    Real out_0_4 = 0;
+    Real out_0_5 = 0;
+    Real out_0_6 = 0;
+    Real out_0_7 = 0;
+    Real out_0_8 = 0;
+    Real out_0_9 = 0;
+    Real out_0_10 = 0;
+    Real out_0_11 = 0;
+    Real out_0_12 = 0;
+    Real out_0_13 = 0;
+    Real out_0_14 = 0;
+    Real out_1_0 = 0;
+    Real out_1_1 = C;
+    Real out_1_2 = 0;
+    Real out_1_3 = 0;
+    Real out_1_4 = 0;
+    Real out_1_5 = 0;
+    Real out_1_6 = 0;
+    Real out_1_7 = 0;
+    Real out_1_8 = 0;
+    Real out_1_9 = 0;
+    Real out_1_10 = 0;
+    Real out_1_11 = 0;
+    Real out_1_12 = 0;
+    Real out_1_13 = 0;
+    Real out_1_14 = 0;
+    Real out_2_0 = 0;
+    Real out_2_1 = 0;
+    Real out_2_2 = C_s;
+    Real out_2_3 = 0;
+    Real out_2_4 = 0;
+    Real out_2_5 = 0;
+    Real out_2_6 = 0;
+    Real out_2_7 = 0;
+    Real out_2_8 = 0;
+    Real out_2_9 = 0;
+    Real out_2_10 = 0;
+    Real out_2_11 = 0;
+    Real out_2_12 = 0;
+    Real out_2_13 = 0;
+    Real out_2_14 = 0;
+    Real out_3_0 = 0;
+    Real out_3_1 = 0;
+    Real out_3_2 = 0;
+    Real out_3_3 = C_s;
+    Real out_3_4 = 0;
+    Real out_3_5 = 0;
+    Real out_3_6 = 0;
+    Real out_3_7 = 0;
+    Real out_3_8 = 0;
+    Real out_3_9 = 0;
+    Real out_3_10 = 0;
+    Real out_3_11 = 0;
+    Real out_3_12 = 0;
+    Real out_3_13 = 0;
+    Real out_3_14 = 0;
+    Real out_4_0 = 0;
+    Real out_4_1 = 0;
+    Real out_4_2 = 0;
+    Real out_4_3 = 0;
+    Real out_4_4 = C_s;
+    Real out_4_5 = 0;
+    Real out_4_6 = 0;
+    Real out_4_7 = 0;
+    Real out_4_8 = 0;
+    Real out_4_9 = 0;
+    Real out_4_10 = 0;
+    Real out_4_11 = 0;
+    Real out_4_12 = 0;
+    Real out_4_13 = 0;
+    Real out_4_14 = 0;
+    Real out_5_0 = 0;
+    Real out_5_1 = 0;
+    Real out_5_2 = 0;
+    Real out_5_3 = 0;
+    Real out_5_4 = 0;
+    Real out_5_5 = C_s;
+    Real out_5_6 = 0;
+    Real out_5_7 = 0;
+    Real out_5_8 = 0;
+    Real out_5_9 = 0;
+    Real out_5_10 = 0;
+    Real out_5_11 = 0;
+    Real out_5_12 = 0;
+    Real out_5_13 = 0;
+    Real out_5_14 = 0;
+    Real out_6_0 = 0;
+    Real out_6_1 = 0;
+    Real out_6_2 = 0;
+    Real out_6_3 = 0;
+    Real out_6_4 = 0;
+    Real out_6_5 = 0;
+    Real out_6_6 = C_p;
+    Real out_6_7 = 0;
+    Real out_6_8 = 0;
+    Real out_6_9 = 0;
+    Real out_6_10 = 0;
+    Real out_6_11 = 0;
+    Real out_6_12 = 0;
+    Real out_6_13 = 0;
+    Real out_6_14 = 0;
+    Real out_7_0 = 0;
+    Real out_7_1 = 0;
+    Real out_7_2 = 0;
+    Real out_7_3 = 0;
+    Real out_7_4 = 0;
+    Real out_7_5 = 0;
+    Real out_7_6 = 0;
+    Real out_7_7 = L_h;
+    Real out_7_8 = 0;
+    Real out_7_9 = 0;
+    Real out_7_10 = 0;
+    Real out_7_11 = 0;
+    Real out_7_12 = 0;
+    Real out_7_13 = 0;
+    Real out_7_14 = 0;
+    Real out_8_0 = 0;
+    Real out_8_1 = 0;
+    Real out_8_2 = 0;
+    Real out_8_3 = 0;
+    Real out_8_4 = 0;
+    Real out_8_5 = 0;
+    Real out_8_6 = 0;
+    Real out_8_7 = 0;
+    Real out_8_8 = L_h;
+    Real out_8_9 = 0;
+    Real out_8_10 = 0;
+    Real out_8_11 = 0;
+    Real out_8_12 = 0;
+    Real out_8_13 = 0;
+    Real out_8_14 = 0;
+    Real out_9_0 = 0;
+    Real out_9_1 = 0;
+    Real out_9_2 = 0;
+    Real out_9_3 = 0;
+    Real out_9_4 = 0;
+    Real out_9_5 = 0;
+    Real out_9_6 = 0;
+    Real out_9_7 = 0;
+    Real out_9_8 = 0;
+    Real out_9_9 = L_s2;
+    Real out_9_10 = 0;
+    Real out_9_11 = 0;
+    Real out_9_12 = 0;
+    Real out_9_13 = 0;
+    Real out_9_14 = 0;
+    Real out_10_0 = 0;
+    Real out_10_1 = 0;
+    Real out_10_2 = 0;
+    Real out_10_3 = 0;
+    Real out_10_4 = 0;
+    Real out_10_5 = 0;
+    Real out_10_6 = 0;
+    Real out_10_7 = 0;
+    Real out_10_8 = 0;
+    Real out_10_9 = 0;
+    Real out_10_10 = L_s3;
+    Real out_10_11 = 0;
+    Real out_10_12 = 0;
+    Real out_10_13 = 0;
+    Real out_10_14 = 0;
+    Real out_11_0 = 0;
+    Real out_11_1 = 0;
+    Real out_11_2 = 0;
+    Real out_11_3 = 0;
+    Real out_11_4 = 0;
+    Real out_11_5 = 0;
+    Real out_11_6 = 0;
+    Real out_11_7 = 0;
+    Real out_11_8 = 0;
+    Real out_11_9 = 0;
+    Real out_11_10 = 0;
+    Real out_11_11 = L_s2;
+    Real out_11_12 = 0;
+    Real out_11_13 = 0;
+    Real out_11_14 = 0;
+    Real out_12_0 = 0;
+    Real out_12_1 = 0;
+    Real out_12_2 = 0;
+    Real out_12_3 = 0;
+    Real out_12_4 = 0;
+    Real out_12_5 = 0;
+    Real out_12_6 = 0;
+    Real out_12_7 = 0;
+    Real out_12_8 = 0;
+    Real out_12_9 = 0;
+    Real out_12_10 = 0;
+    Real out_12_11 = 0;
+    Real out_12_12 = L_s3;
+    Real out_12_13 = 0;
+    Real out_12_14 = 0;
+    Real out_13_0 = 0;
+    Real out_13_1 = 0;
+    Real out_13_2 = 0;
+    Real out_13_3 = 0;
+    Real out_13_4 = 0;
+    Real out_13_5 = 0;
+    Real out_13_6 = 0;
+    Real out_13_7 = 0;
+    Real out_13_8 = 0;
+    Real out_13_9 = 0;
+    Real out_13_10 = 0;
+    Real out_13_11 = 0;
+    Real out_13_12 = 0;
+    Real out_13_13 = L_s1;
+    Real out_13_14 = 0;
+    Real out_14_0 = 0;
+    Real out_14_1 = 0;
+    Real out_14_2 = 0;
+    Real out_14_3 = 0;
+    Real out_14_4 = 0;
+    Real out_14_5 = 0;
+    Real out_14_6 = 0;
+    Real out_14_7 = 0;
+    Real out_14_8 = 0;
+    Real out_14_9 = 0;
+    Real out_14_10 = 0;
+    Real out_14_11 = 0;
+    Real out_14_12 = 0;
+    Real out_14_13 = 0;
+    Real out_14_14 = L_s1;
+
+    // Return results
+    MatrixJF out_JF_x_dot;
+    out_JF_x_dot <<
+      out_0_0, out_0_1, out_0_2, out_0_3, out_0_4, out_0_5, out_0_6, out_0_7, out_0_8, out_0_9, out_0_10, out_0_11, out_0_12, out_0_13, out_0_14, out_1_0, out_1_1, out_1_2, out_1_3, out_1_4, out_1_5, out_1_6, out_1_7, out_1_8, out_1_9, out_1_10, out_1_11, out_1_12, out_1_13, out_1_14, out_2_0, out_2_1, out_2_2, out_2_3, out_2_4, out_2_5, out_2_6, out_2_7, out_2_8, out_2_9, out_2_10, out_2_11, out_2_12, out_2_13, out_2_14, out_3_0, out_3_1, out_3_2, out_3_3, out_3_4, out_3_5, out_3_6, out_3_7, out_3_8, out_3_9, out_3_10, out_3_11, out_3_12, out_3_13, out_3_14, out_4_0, out_4_1, out_4_2, out_4_3, out_4_4, out_4_5, out_4_6, out_4_7, out_4_8, out_4_9, out_4_10, out_4_11, out_4_12, out_4_13, out_4_14, out_5_0, out_5_1, out_5_2, out_5_3, out_5_4, out_5_5, out_5_6, out_5_7, out_5_8, out_5_9, out_5_10, out_5_11, out_5_12, out_5_13, out_5_14, out_6_0, out_6_1, out_6_2, out_6_3, out_6_4, out_6_5, out_6_6, out_6_7, out_6_8, out_6_9, out_6_10, out_6_11, out_6_12, out_6_13, out_6_14, out_7_0, out_7_1, out_7_2, out_7_3, out_7_4, out_7_5, out_7_6, out_7_7, out_7_8, out_7_9, out_7_10, out_7_11, out_7_12, out_7_13, out_7_14, out_8_0, out_8_1, out_8_2, out_8_3, out_8_4, out_8_5, out_8_6, out_8_7, out_8_8, out_8_9, out_8_10, out_8_11, out_8_12, out_8_13, out_8_14, out_9_0, out_9_1, out_9_2, out_9_3, out_9_4, out_9_5, out_9_6, out_9_7, out_9_8, out_9_9, out_9_10, out_9_11, out_9_12, out_9_13, out_9_14, out_10_0, out_10_1, out_10_2, out_10_3, out_10_4, out_10_5, out_10_6, out_10_7, out_10_8, out_10_9, out_10_10, out_10_11, out_10_12, out_10_13, out_10_14, out_11_0, out_11_1, out_11_2, out_11_3, out_11_4, out_11_5, out_11_6, out_11_7, out_11_8, out_11_9, out_11_10, out_11_11, out_11_12, out_11_13, out_11_14, out_12_0, out_12_1, out_12_2, out_12_3, out_12_4, out_12_5, out_12_6, out_12_7, out_12_8, out_12_9, out_12_10, out_12_11, out_12_12, out_12_13, out_12_14, out_13_0, out_13_1, out_13_2, out_13_3, out_13_4, out_13_5, out_13_6, out_13_7, out_13_8, out_13_9, out_13_10, out_13_11, out_13_12, out_13_13, out_13_14, out_14_0, out_14_1, out_14_2, out_14_3, out_14_4, out_14_5, out_14_6, out_14_7, out_14_8, out_14_9, out_14_10, out_14_11, out_14_12, out_14_13, out_14_14;
+    return out_JF_x_dot;
+  }
+
+  // Calculate the vector h of the invariants.
+  VectorH h(VectorF const & /*in_0*/, Real /*in_1*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    // Nothing to evaluate
+
+    // Return results
+    VectorH out_h;
+    out_h.setZero();
+    return out_h;
+  }
+
+  // Calculate the Jacobian of h with respect to x.
+  MatrixJH Jh_x(VectorF const & /*in_0*/, Real /*in_1*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    // Nothing to evaluate
+
+    // Return results
+    MatrixJH out_Jh_x;
+    out_Jh_x.setZero();
+    return out_Jh_x;
+  }
+
+  // Check if the system is in the defined domain.
+  bool in_domain(VectorF const &/*x*/, Real /*t*/) const override {return true;}
+
+  // Return the initial integration time
+  Real t_ini() const {return 0.;}
+
+  // Return the final integration time
+  Real t_end() const {return 0.1e-2;}
+
+  // Evaluate the initial conditions.
+  VectorF ics() const
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0 = 0.0e0;
+    Real out_1 = 0.0e0;
+    Real out_2 = 0.0e0;
+    Real out_3 = 0.0e0;
+    Real out_4 = 0.0e0;
+    Real out_5 = 0.0e0;
+    Real out_6 = 0.0e0;
+    Real out_7 = 0.0e0;
+    Real out_8 = 0.0e0;
+    Real out_9 = 0.0e0;
+    Real out_10 = 0.0e0;
+    Real out_11 = 0.0e0;
+    Real out_12 = 0.0e0;
+    Real out_13 = 0.0e0;
+    Real out_14 = 0.0e0;
+
+    // Return results
+    VectorF out_ics;
+    out_ics <<
+      out_0, out_1, out_2, out_3, out_4, out_5, out_6, out_7, out_8, out_9, out_10, out_11, out_12, out_13, out_14;
+    return out_ics;
+  }
+
+}; // class RingModulator
+
+#endif // SANDALS_MAPLE_RINGMODULATOR_IMPLICIT_HH
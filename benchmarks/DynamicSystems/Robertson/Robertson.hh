@@ -0,0 +1,227 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// C++ generated code for implicit system: Robertson
+// This file has been automatically generated by Sandals.
+// DISCLAIMER: If you need to edit it, do it wisely!
+
+#ifndef SANDALS_MAPLE_ROBERTSON_IMPLICIT_HH
+#define SANDALS_MAPLE_ROBERTSON_IMPLICIT_HH
+
+using namespace Sandals;
+using namespace std;
+
+// No class description available.
+template<typename Real = double>
+class Robertson : public Implicit<Real, 3, 0>
+{
+  // Class data
+  Real m_k_1{.4e-1}; // Data variable 1
+  Real m_k_2{.3e8}; // Data variable 2
+  Real m_k_3{.1e5}; // Data variable 3
+
+public:
+  using VectorF  = typename Implicit<Real, 3, 0>::VectorF;
+  using MatrixJF = typename Implicit<Real, 3, 0>::MatrixJF;
+  using VectorH  = typename Implicit<Real, 3, 0>::VectorH;
+  using MatrixJH = typename Implicit<Real, 3, 0>::MatrixJH;
+
+  // Class constructor.
+  Robertson() : Implicit<Real, 3, 0>("Robertson") {}
+
+  // Data variable 1 getter.
+  Real get_k_1() const {return this->m_k_1;}
+
+  // Data variable 1 setter.
+  void set_k_1(Real t_k_1) {this->m_k_1 = t_k_1;}
+
+  // Data variable 2 getter.
+  Real get_k_2() const {return this->m_k_2;}
+
+  // Data variable 2 setter.
+  void set_k_2(Real t_k_2) {this->m_k_2 = t_k_2;}
+
+  // Data variable 3 getter.
+  Real get_k_3() const {return this->m_k_3;}
+
+  // Data variable 3 setter.
+  void set_k_3(Real t_k_3) {this->m_k_3 = t_k_3;}
+
+  // Evaluate the function F.
+  VectorF F(VectorF const & in_0, VectorF const & in_1, Real /*in_2*/) const override
+  {
+    // Create data' aliases
+    Real const & k_1 = this->m_k_1; // Data variable 1
+    Real const & k_2 = this->m_k_2; // Data variable 2
+    Real const & k_3 = this->m_k_3; // Data variable 3
+
+    // Create inputs' aliases
+    Real const & y_1 = in_0(0); // State variable 1
+    Real const & y_2 = in_0(1); // State variable 2
+    Real const & y_3 = in_0(2); // State variable 3
+    Real const & y_1_dot = in_1(0); // State variable 1 derivative
+    Real const & y_2_dot = in_1(1); // State variable 2 derivative
+    Real const & y_3_dot = in_1(2); // State variable 3 derivative
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0 = y_1_dot + k_1 * y_1 - k_3 * y_2 * y_3;
+    Real out_1 = y_2_dot - k_1 * y_1 + k_3 * y_2 * y_3 + k_2 * y_2 * y_2;
+    Real out_2 = y_3_dot - k_2 * y_2 * y_2;
+
+    // Return results
+    VectorF out_F;
+    out_F <<
+      out_0, out_1, out_2;
+    return out_F;
+  }
+
+  // Evaluate the Jacobian of F with respect to x.
+  MatrixJF JF_x(VectorF const & in_0, VectorF const & /*in_1*/, Real /*in_2*/) const override
+  {
+    // Create data' aliases
+    Real const & k_1 = this->m_k_1; // Data variable 1
+    Real const & k_2 = this->m_k_2; // Data variable 2
+    Real const & k_3 = this->m_k_3; // Data variable 3
+
+    // Create inputs' aliases
+    Real const & y_2 = in_0(1); // State variable 2
+    Real const & y_3 = in_0(2); // State variable 3
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0_0 = k_1;
+    Real out_0_1 = -k_3 * y_3;
+    Real out_0_2 = -k_3 * y_2;
+    Real out_1_0 = -k_1;
+    Real out_1_1 = k_3 * y_3 + 2 * k_2 * y_2;
+    Real out_1_2 = k_3 * y_2;
+    Real out_2_0 = 0;
+    Real out_2_1 = -2 * k_2 * y_2;
+    Real out_2_2 = 0;
+
+    // Return results
+    MatrixJF out_JF_x;
+    out_JF_x <<
+      out_0_0, out_0_1, out_0_2, out_1_0, out_1_1, out_1_2, out_2_0, out_2_1, out_2_2;
+    return out_JF_x;
+  }
+  // Evaluate the Jacobian of F with respect to x_dot.
+  MatrixJF JF_x_dot(VectorF const & /*in_0*/, VectorF const & /*in_1*/, Real /*in_2*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0_0 = 1;
+    Real out_0_1 = 0;
+    Real out_0_2 = 0;
+    Real out_1_0 = 0;
+    Real out_1_1 = 1;
+    Real out_1_2 = 0;
+    Real out_2_0 = 0;
+    Real out_2_1 = 0;
+    Real out_2_2 = 1;
+
+    // Return results
+    MatrixJF out_JF_x_dot;
+    out_JF_x_dot <<
+      out_0_0, out_0_1, out_0_2, out_1_0, out_1_1, out_1_2, out_2_0, out_2_1, out_2_2;
+    return out_JF_x_dot;
+  }
+
+  // Calculate the vector h of the invariants.
+  VectorH h(VectorF const & /*in_0*/, Real /*in_1*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    // Nothing to evaluate
+
+    // Return results
+    VectorH out_h;
+    out_h.setZero();
+    return out_h;
+  }
+
+  // Calculate the Jacobian of h with respect to x.
+  MatrixJH Jh_x(VectorF const & /*in_0*/, Real /*in_1*/) const override
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    // Nothing to evaluate
+
+    // Return results
+    MatrixJH out_Jh_x;
+    out_Jh_x.setZero();
+    return out_Jh_x;
+  }
+
+  // Check if the system is in the defined domain.
+  bool in_domain(VectorF const &/*x*/, Real /*t*/) const override {return true;}
+
+  // Return the initial integration time
+  Real t_ini() const {return 0.;}
+
+  // Return the final integration time
+  Real t_end() const {return 0.1e12;}
+
+  // Evaluate the initial conditions.
+  VectorF ics() const
+  {
+    // Create data' aliases
+    // None
+
+    // Create inputs' aliases
+    // None
+
+    // Evaluate computation sequence
+    // Nothing to evaluate
+
+    // Evaluate function entries
+    Real out_0 = 0.1e1;
+    Real out_1 = 0.0e0;
+    Real out_2 = 0.0e0;
+
+    // Return results
+    VectorF out_ics;
+    out_ics <<
+      out_0, out_1, out_2;
+    return out_ics;
+  }
+
+}; // class Robertson
+
+#endif // SANDALS_MAPLE_ROBERTSON_IMPLICIT_HH
@@ -0,0 +1,217 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "Sandals.hh"
+#include "Sandals/TicToc.hh"
+#include "Sandals/RungeKutta.hh"
+
+#include "Benchmark.hh"
+
+using namespace Sandals;
+using Real = double;
+
+// Synthetic explicit system of size N with one quadratic invariant. The right-hand side is a
+// weakly nonlinear ring of coupled decaying states, so that every kernel does a representative
+// amount of work for any N, and the invariant keeps the projection busy.
+template<Integer N>
+class Synthetic : public Explicit<Real, N, 1>
+{
+public:
+  using VectorF  = typename Explicit<Real, N, 1>::VectorF;
+  using MatrixJF = typename Explicit<Real, N, 1>::MatrixJF;
+  using VectorH  = typename Explicit<Real, N, 1>::VectorH;
+  using MatrixJH = typename Explicit<Real, N, 1>::MatrixJH;
+
+  Synthetic() : Explicit<Real, N, 1>("Synthetic") {}
+
+  VectorF f(VectorF const &x, Real /*t*/) const override
+  {
+    VectorF f;
+    for (Integer i{0}; i < N; ++i) {f(i) = -x(i) + 0.1*std::sin(x((i+1) % N));}
+    return f;
+  }
+
+  MatrixJF Jf_x(VectorF const &x, Real /*t*/) const override
+  {
+    MatrixJF Jf_x(-MatrixJF::Identity());
+    for (Integer i{0}; i < N; ++i) {Jf_x(i, (i+1) % N) += 0.1*std::cos(x((i+1) % N));}
+    return Jf_x;
+  }
+
+  VectorH h(VectorF const &x, Real /*t*/) const override
+  {
+    VectorH h;
+    h << 0.5*x.squaredNorm() - 0.5*N;
+    return h;
+  }
+
+  MatrixJH Jh_x(VectorF const &x, Real /*t*/) const override {return x.transpose();}
+
+  bool in_domain(VectorF const &/*x*/, Real /*t*/) const override {return true;}
+
+  VectorF ics() const {return VectorF::Ones();}
+};
+
+// Synthetic Butcher tableau with S stages and the occupancy of the requested Runge-Kutta type.
+// The coefficients are consistent (the nodes are the row sums) but carry no accuracy, as only the
+// cost of the kernels is of interest here.
+template<Integer S>
+Tableau<Real, S> synthetic_tableau(typename Tableau<Real, S>::Type type)
+{
+  using Type = typename Tableau<Real, S>::Type;
+  Tableau<Real, S> tableau;
+  tableau.name  = "Synthetic";
+  tableau.type  = type;
+  tableau.order = 1;
+  tableau.A.setZero();
+  for (Integer i{0}; i < S; ++i) {
+    for (Integer j{0}; j < S; ++j) {
+      if (type == Type::IRK || (type == Type::DIRK && j <= i) || (type == Type::ERK && j < i)) {
+        tableau.A(i, j) = 1.0/(S + i + j + 1.0);
+      }
+    }
+  }
+  tableau.b = Tableau<Real, S>::Vector::Constant(1.0/S);
+  tableau.c = tableau.A.rowwise().sum();
+  return tableau;
+}
+
+// Benchmark settings
+static Integer     warm_up{2};                        // Untimed warm-up batches
+static Integer     repetitions{7};                    // Timed batches per kernel
+static Real        batch_ms{2.0};                     // Target duration of a timed batch
+static std::string output_prefix{"benchmark_kernels"}; // Output files prefix
+
+// Time a kernel in batches of calls. The batch size is calibrated so that a batch lasts about
+// batch_ms milliseconds, which keeps the clock resolution negligible also for the cheapest kernels.
+// The median batch time is used for the time per call and the throughput.
+template<typename Function>
+void time_kernel(std::string const &kernel, Integer N, Integer S, Function &&function, BenchmarkTable &table)
+{
+  Integer batch{1};
+  TicToc<Real> timer;
+  while (true) {
+    timer.tic();
+    for (Integer i{0}; i < batch; ++i) {function();}
+    timer.toc();
+    if (timer.elapsed_ms() > batch_ms || batch > (1 << 24)) {break;}
+    batch *= 2;
+  }
+
+  timer.reset();
+  timer.warm_up(warm_up);
+  timer.run([&function, batch] () {for (Integer i{0}; i < batch; ++i) {function();}}, repetitions);
+
+  Real ns_per_call{1.0e6*timer.median_ms()/batch};
+  table.add_row({
+    BenchmarkTable::field("kernel",          kernel),
+    BenchmarkTable::field("N",               N),
+    BenchmarkTable::field("S",               S),
+    BenchmarkTable::field("NS",              N*S),
+    BenchmarkTable::field("skipped",         false),
+    BenchmarkTable::field("calls_per_batch", batch),
+    BenchmarkTable::field("ns_per_call",     ns_per_call),
+    BenchmarkTable::field("calls_per_s",     1.0e9/ns_per_call),
+    BenchmarkTable::field("rel_stddev",      timer.stddev_ms()/timer.mean_ms())
+  });
+}
+
+// Append a row for a kernel that cannot be instantiated.
+void skip_kernel(std::string const &kernel, Integer N, Integer S, BenchmarkTable &table)
+{
+  Real const nan{std::numeric_limits<Real>::quiet_NaN()};
+  table.add_row({
+    BenchmarkTable::field("kernel",          kernel),
+    BenchmarkTable::field("N",               N),
+    BenchmarkTable::field("S",               S),
+    BenchmarkTable::field("NS",              N*S),
+    BenchmarkTable::field("skipped",         true),
+    BenchmarkTable::field("calls_per_batch", 0),
+    BenchmarkTable::field("ns_per_call",     nan),
+    BenchmarkTable::field("calls_per_s",     nan),
+    BenchmarkTable::field("rel_stddev",      nan)
+  });
+}
+
+// Benchmark all the kernels for the given system and stages sizes. The fixed-size stage Jacobian
+// of N*S x N*S entries must fit the Eigen stack allocation limit, otherwise the size is skipped.
+template<Integer N, Integer S>
+void run(BenchmarkTable &table)
+{
+  using Method  = RungeKutta<Real, S, N, 1>;
+  using Type    = typename Tableau<Real, S>::Type;
+  using VectorN = Eigen::Vector<Real, N>;
+  using MatrixK = Eigen::Matrix<Real, N, S>;
+  using VectorK = Eigen::Vector<Real, N*S>;
+  using MatrixJ = Eigen::Matrix<Real, N*S, N*S>;
+
+  std::vector<std::string> const kernels{"erk_explicit_step", "erk_implicit_step", "irk_function",
+    "irk_jacobian", "dirk_step", "estimate_step", "project"};
+
+  if constexpr (sizeof(Real)*N*S*N*S > EIGEN_STACK_ALLOCATION_LIMIT) {
+    for (std::string const &kernel : kernels) {skip_kernel(kernel, N, S, table);}
+  } else {
+    auto system = std::make_shared<Synthetic<N>>();
+    VectorN x(system->ics()), x_new, x_e(system->ics() * (1.0 + 1.0e-6));
+    Real t{0.0}, h{1.0e-2}, h_new{h};
+    MatrixK K(MatrixK::Zero());
+    VectorK K_vec(VectorK::Constant(h)), fun;
+    MatrixJ jac;
+
+    auto erk{std::make_unique<Method>(synthetic_tableau<S>(Type::ERK), system)};
+    auto irk{std::make_unique<Method>(synthetic_tableau<S>(Type::IRK), system)};
+    auto dirk{std::make_unique<Method>(synthetic_tableau<S>(Type::DIRK), system)};
+
+    time_kernel("erk_explicit_step", N, S, [&] () {erk->erk_explicit_step(x, t, h, x_new, h_new, K);}, table);
+    time_kernel("erk_implicit_step", N, S, [&] () {erk->erk_implicit_step(x, t, h, x_new, h_new, K);}, table);
+    time_kernel("irk_function", N, S, [&] () {irk->irk_function(x, t, h, K_vec, fun);}, table);
+    time_kernel("irk_jacobian", N, S, [&] () {irk->irk_jacobian(x, t, h, K_vec, jac);}, table);
+    time_kernel("dirk_step", N, S, [&] () {dirk->dirk_step(x, t, h, x_new, h_new, K);}, table);
+    time_kernel("estimate_step", N, S, [&] () {h_new = erk->estimate_step(x, x_e, h);}, table);
+    time_kernel("project", N, S, [&] () {erk->project(x_e, t, x_new);}, table);
+  }
+}
+
+// Benchmark all the stages sizes from 1 to 10 for the given system size.
+template<Integer N>
+void run_all(BenchmarkTable &table)
+{
+  run<N, 1>(table);
+  run<N, 2>(table);
+  run<N, 3>(table);
+  run<N, 4>(table);
+  run<N, 5>(table);
+  run<N, 6>(table);
+  run<N, 7>(table);
+  run<N, 8>(table);
+  run<N, 9>(table);
+  run<N, 10>(table);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1) {output_prefix = argv[1];}
+  if (argc > 2) {repetitions = std::max(1, std::atoi(argv[2]));}
+  if (argc > 3) {batch_ms = std::max(0.01, std::atof(argv[3]));}
+
+  BenchmarkTable table("kernels");
+
+  run_all<2>(table);
+  run_all<6>(table);
+  run_all<12>(table);
+  run_all<50>(table);
+
+  table.print(std::cout);
+  if (!table.write(output_prefix)) {
+    std::cerr << "Unable to write the results with prefix '" << output_prefix << "'." << std::endl;
+    return 1;
+  }
+  return 0;
+}
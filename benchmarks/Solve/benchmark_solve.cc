@@ -0,0 +1,242 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "Sandals.hh"
+#include "Sandals/TicToc.hh"
+
+#include "Sandals/RungeKutta/Chebyshev51.hh"
+#include "Sandals/RungeKutta/ExplicitEuler.hh"
+#include "Sandals/RungeKutta/Fehlberg45.hh"
+#include "Sandals/RungeKutta/GaussLegendre2.hh"
+#include "Sandals/RungeKutta/GaussLegendre4.hh"
+#include "Sandals/RungeKutta/GaussLegendre6.hh"
+#include "Sandals/RungeKutta/Heun2.hh"
+#include "Sandals/RungeKutta/Heun3.hh"
+#include "Sandals/RungeKutta/LobattoIIIA2.hh"
+#include "Sandals/RungeKutta/ImplicitEuler.hh"
+#include "Sandals/RungeKutta/MTE22.hh"
+#include "Sandals/RungeKutta/RadauIIA3.hh"
+#include "Sandals/RungeKutta/RadauIIA5.hh"
+#include "Sandals/RungeKutta/Ralston2.hh"
+#include "Sandals/RungeKutta/Ralston3.hh"
+#include "Sandals/RungeKutta/Ralston4.hh"
+#include "Sandals/RungeKutta/RK4.hh"
+#include "Sandals/RungeKutta/SSPIRK33.hh"
+#include "Sandals/RungeKutta/SSPRK22.hh"
+#include "Sandals/RungeKutta/SSPRK22star.hh"
+#include "Sandals/RungeKutta/SSPRK33.hh"
+#include "Sandals/RungeKutta/SSPRK42.hh"
+#include "Sandals/RungeKutta/SSPRK43.hh"
+#include "Sandals/RungeKutta/SSPRK93.hh"
+#include "Sandals/RungeKutta/SSPRK104.hh"
+
+#include "OscillatorImplicit.hh"
+#include "SimplePendulumImplicit.hh"
+#include "ThreeBodyImplicit.hh"
+#include "ChemAkzo/ChemAkzo.hh"
+
+#include "Benchmark.hh"
+
+using namespace Sandals;
+using Real = double;
+
+// Benchmark problem, i.e., a system with its initial conditions, integration mesh, and reference
+// solution at the end of the integration interval.
+template<typename System>
+struct Problem
+{
+  static constexpr Integer N{System::VectorF::RowsAtCompileTime};
+  static constexpr Integer M{System::VectorH::RowsAtCompileTime};
+
+  using VectorN = Eigen::Vector<Real, N>;
+  using VectorX = Eigen::Vector<Real, Eigen::Dynamic>;
+
+  std::string             name;      // Problem name
+  std::shared_ptr<System> system;    // System to be integrated
+  VectorN                 ics;       // Initial conditions
+  VectorX                 mesh;      // Integration mesh
+  VectorN                 reference; // Reference solution at the last mesh point
+};
+
+// Benchmark settings
+static Integer     warm_up{1};                    // Untimed warm-up runs
+static Integer     repetitions{5};                // Timed repetitions per run
+static std::string output_prefix{"benchmark_solve"}; // Output files prefix
+
+// Solve the problem with the given method and append the results to the table. Each run is timed
+// over several repetitions, after the warm-up runs, and the statistics of the wall times are reported.
+template<template<typename, Integer, Integer> class Method, typename System>
+void run(Problem<System> const &problem, bool adaptive, BenchmarkTable &table)
+{
+  constexpr Integer N{Problem<System>::N};
+  constexpr Integer M{Problem<System>::M};
+
+  Method<Real, N, M> rk(problem.system);
+  if (adaptive && !rk.is_embedded()) {return;}
+
+  Solution<Real, N, M> sol;
+  TicToc<Real> timer(warm_up);
+  bool success{true};
+  std::string message;
+  try {
+    for (Integer i{0}; i < warm_up + repetitions; ++i) {
+      timer.tic();
+      success = adaptive ?
+        rk.adaptive_solve(problem.mesh, problem.ics, sol) :
+        rk.solve(problem.mesh, problem.ics, sol);
+      timer.toc();
+      if (!success) {break;}
+    }
+  } catch (std::exception const &e) {
+    success = false;
+    message = e.what();
+  }
+
+  Real error{std::numeric_limits<Real>::quiet_NaN()};
+  Integer steps{0};
+  if (success && sol.size() > 0) {
+    steps = sol.size() - 1;
+    error = (sol.x.col(sol.size()-1) - problem.reference).template lpNorm<Eigen::Infinity>();
+    if (std::abs(sol.t(sol.size()-1) - problem.mesh(problem.mesh.size()-1)) > 1.0e-8) {
+      success = false; // The integration did not reach the end of the mesh
+    }
+  }
+
+  table.add_row({
+    BenchmarkTable::field("system",         problem.name),
+    BenchmarkTable::field("method",         rk.name()),
+    BenchmarkTable::field("stages",         rk.stages()),
+    BenchmarkTable::field("order",          rk.order()),
+    BenchmarkTable::field("mode",           adaptive ? "adaptive" : "fixed"),
+    BenchmarkTable::field("success",        success),
+    BenchmarkTable::field("steps",          steps),
+    BenchmarkTable::field("time_min_ms",    success ? timer.min_ms() : std::numeric_limits<Real>::quiet_NaN()),
+    BenchmarkTable::field("time_median_ms", success ? timer.median_ms() : std::numeric_limits<Real>::quiet_NaN()),
+    BenchmarkTable::field("time_mean_ms",   success ? timer.mean_ms() : std::numeric_limits<Real>::quiet_NaN()),
+    BenchmarkTable::field("time_stddev_ms", success ? timer.stddev_ms() : std::numeric_limits<Real>::quiet_NaN()),
+    BenchmarkTable::field("error_inf",      success ? error : std::numeric_limits<Real>::quiet_NaN())
+  });
+  if (!message.empty()) {std::cerr << problem.name << " - " << rk.name() << ": " << message << std::endl;}
+}
+
+// Run every method on the given problem, both on the fixed mesh and, for embedded methods, with
+// the adaptive step-size control.
+template<typename System>
+void run_all(Problem<System> const &problem, BenchmarkTable &table)
+{
+  for (bool adaptive : {false, true}) {
+    run<Chebyshev51>(problem, adaptive, table);
+    run<ExplicitEuler>(problem, adaptive, table);
+    run<Fehlberg45>(problem, adaptive, table);
+    run<GaussLegendre2>(problem, adaptive, table);
+    run<GaussLegendre4>(problem, adaptive, table);
+    run<GaussLegendre6>(problem, adaptive, table);
+    run<Heun2>(problem, adaptive, table);
+    run<Heun3>(problem, adaptive, table);
+    run<LobattoIIIA2>(problem, adaptive, table);
+    run<ImplicitEuler>(problem, adaptive, table);
+    run<MTE22>(problem, adaptive, table);
+    run<RadauIIA3>(problem, adaptive, table);
+    run<RadauIIA5>(problem, adaptive, table);
+    run<Ralston2>(problem, adaptive, table);
+    run<Ralston3>(problem, adaptive, table);
+    run<Ralston4>(problem, adaptive, table);
+    run<RK4>(problem, adaptive, table);
+    run<SSPIRK33>(problem, adaptive, table);
+    run<SSPRK22>(problem, adaptive, table);
+    run<SSPRK22star>(problem, adaptive, table);
+    run<SSPRK33>(problem, adaptive, table);
+    run<SSPRK42>(problem, adaptive, table);
+    run<SSPRK43>(problem, adaptive, table);
+    run<SSPRK93>(problem, adaptive, table);
+    run<SSPRK104>(problem, adaptive, table);
+  }
+}
+
+// Compute a reference solution for problems without an analytical one, by integrating with the
+// highest order method on a refined mesh.
+template<typename System>
+typename Problem<System>::VectorN reference(Problem<System> const &problem, Integer refinement)
+{
+  constexpr Integer N{Problem<System>::N};
+  constexpr Integer M{Problem<System>::M};
+
+  GaussLegendre6<Real, N, M> rk(problem.system);
+  Eigen::VectorXd mesh(Eigen::VectorXd::LinSpaced((problem.mesh.size()-1)*refinement+1,
+    problem.mesh(0), problem.mesh(problem.mesh.size()-1)));
+  Solution<Real, N, M> sol;
+  SANDALS_ASSERT(rk.solve(mesh, problem.ics, sol), "Reference solution computation failed.");
+  return sol.x.col(sol.size()-1);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1) {output_prefix = argv[1];}
+  if (argc > 2) {repetitions = std::max(1, std::atoi(argv[2]));}
+
+  BenchmarkTable table("solve");
+
+  // Harmonic oscillator with analytical solution
+  {
+    Problem<OscillatorImplicit<Real>> problem;
+    problem.name      = "Oscillator";
+    problem.system    = std::make_shared<OscillatorImplicit<Real>>();
+    problem.ics       = problem.system->ics();
+    problem.mesh      = Eigen::VectorXd::LinSpaced(1001, 0.0, 10.0);
+    problem.reference = problem.system->analytical_solution(10.0);
+    run_all(problem, table);
+  }
+
+  // Simple pendulum with reference solution on a refined mesh
+  {
+    Problem<SimplePendulumImplicit<Real>> problem;
+    problem.name      = "SimplePendulum";
+    problem.system    = std::make_shared<SimplePendulumImplicit<Real>>();
+    problem.ics       = problem.system->ics();
+    problem.mesh      = Eigen::VectorXd::LinSpaced(1001, 0.0, 10.0);
+    problem.reference = reference(problem, 16);
+    run_all(problem, table);
+  }
+
+  // Three body problem (figure-eight orbit) with reference solution on a refined mesh
+  {
+    Problem<ThreeBodyImplicit<Real>> problem;
+    problem.name      = "ThreeBody";
+    problem.system    = std::make_shared<ThreeBodyImplicit<Real>>();
+    problem.ics       = problem.system->ics();
+    problem.mesh      = Eigen::VectorXd::LinSpaced(2001, 0.0, 6.32591398);
+    problem.reference = reference(problem, 16);
+    run_all(problem, table);
+  }
+
+  // Chemical Akzo Nobel index-1 DAE with the reference solution from the IVP test set
+  {
+    Problem<ChemAkzo<Real>> problem;
+    problem.name   = "ChemAkzo";
+    problem.system = std::make_shared<ChemAkzo<Real>>();
+    problem.ics    = problem.system->ics();
+    problem.mesh   = Eigen::VectorXd::LinSpaced(1801, problem.system->t_ini(), problem.system->t_end());
+    problem.reference <<
+      0.1150794920661702e+0,
+      0.1203831471567715e-2,
+      0.1611562887407974e+0,
+      0.3656156421249283e-3,
+      0.1708010885264404e-1,
+      0.4873531310307455e-2;
+    run_all(problem, table);
+  }
+
+  table.print(std::cout);
+  if (!table.write(output_prefix)) {
+    std::cerr << "Unable to write the results with prefix '" << output_prefix << "'." << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,346 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "Sandals.hh"
+#include "Sandals/TicToc.hh"
+
+#include "Sandals/RungeKutta/GaussLegendre6.hh"
+#include "Sandals/RungeKutta/RadauIIA5.hh"
+#include "Sandals/RungeKutta/SSPIRK33.hh"
+
+#include "Andrews/Andrews.hh"
+#include "CarAxis/CarAxis.hh"
+#include "ChemAkzo/ChemAkzo.hh"
+#include "HIRES/HIRES.hh"
+#include "Pollution/Pollution.hh"
+#include "RingModulator/RingModulator.hh"
+#include "Robertson/Robertson.hh"
+#include "VanDerPol/VanDerPol.hh"
+
+#include "Benchmark.hh"
+
+using namespace Sandals;
+using Real = double;
+
+// Stiff benchmark problem, i.e., a system from the IVP test set with its initial conditions, the
+// coarsest integration mesh, and the reference solution at the end of the integration interval.
+// The reference solutions are the ones of the IVP test set for ChemAkzo, HIRES, Robertson and
+// Pollution. The other ones are computed offline and are accurate to about 10 significant digits:
+// Van der Pol, Andrews and car axis with DOP853 and Radau at tolerances close to the machine
+// precision, the ring modulator with GaussLegendre6 on 640000 steps and Richardson extrapolation.
+template<typename System>
+struct Problem
+{
+  static constexpr Integer N{System::VectorF::RowsAtCompileTime};
+  static constexpr Integer M{System::VectorH::RowsAtCompileTime};
+
+  using VectorN = Eigen::Vector<Real, N>;
+
+  std::string             name;      // Problem name
+  std::shared_ptr<System> system;    // System to be integrated
+  VectorN                 ics;       // Initial conditions
+  Integer                 intervals; // Intervals of the coarsest mesh
+  Real                    decades;   // Decades of the logarithmic mesh grading (zero for uniform)
+  VectorN                 reference; // Reference solution at the end of the integration interval
+};
+
+// Benchmark settings
+static Integer     warm_up{1};                       // Untimed warm-up runs
+static Integer     repetitions{3};                   // Timed repetitions per run
+static Integer     levels{5};                        // Mesh refinement levels
+static std::string output_prefix{"benchmark_stiff"}; // Output files prefix
+
+// Build the integration mesh with the given number of intervals. The mesh is uniform if the decades
+// are zero, otherwise the points after the first are logarithmically spaced over the given number
+// of decades, so that the initial transients and the long-time behaviour are both resolved.
+template<typename System>
+Eigen::VectorXd mesh(Problem<System> const &problem, Integer intervals)
+{
+  Real t_ini{problem.system->t_ini()}, t_end{problem.system->t_end()};
+  if (problem.decades <= 0.0) {return Eigen::VectorXd::LinSpaced(intervals+1, t_ini, t_end);}
+  Eigen::VectorXd t_mesh(intervals+1);
+  t_mesh(0) = t_ini;
+  for (Integer k{1}; k <= intervals; ++k) {
+    Real s{static_cast<Real>(k-1)/static_cast<Real>(std::max(1, intervals-1)) - 1.0};
+    t_mesh(k) = t_ini + (t_end - t_ini) * std::pow(10.0, problem.decades * s);
+  }
+  return t_mesh;
+}
+
+// Solve the problem with the given method over the sequence of refined meshes, and append a row
+// per mesh to the table. The accuracy is scored by the significant correct digits of the solution
+// at the end of the integration interval with respect to the reference solution.
+template<template<typename, Integer, Integer> class Method, typename System>
+void run(Problem<System> const &problem, BenchmarkTable &table)
+{
+  constexpr Integer N{Problem<System>::N};
+  constexpr Integer M{Problem<System>::M};
+
+  Method<Real, N, M> rk(problem.system);
+  Solution<Real, N, M> sol;
+  TicToc<Real> timer(warm_up);
+  for (Integer k{0}; k < levels; ++k) {
+    Integer intervals{problem.intervals * (1 << k)};
+    Eigen::VectorXd t_mesh(mesh(problem, intervals));
+
+    timer.reset();
+    bool success{true};
+    std::string message;
+    try {
+      for (Integer i{0}; i < warm_up + repetitions; ++i) {
+        timer.tic();
+        success = rk.solve(t_mesh, problem.ics, sol);
+        timer.toc();
+        if (!success) {break;}
+      }
+    } catch (std::exception const &e) {
+      success = false;
+      message = e.what();
+    }
+
+    Real const nan{std::numeric_limits<Real>::quiet_NaN()};
+    Real error{nan}, digits{nan};
+    if (success && sol.size() == t_mesh.size() && sol.x.col(sol.size()-1).allFinite()) {
+      error  = (sol.x.col(sol.size()-1) - problem.reference).template lpNorm<Eigen::Infinity>();
+      digits = significant_digits(sol.x.col(sol.size()-1), problem.reference);
+    } else {
+      success = false;
+    }
+
+    Statistics const &stats = rk.statistics();
+    table.add_row({
+      BenchmarkTable::field("system",            problem.name),
+      BenchmarkTable::field("method",            rk.name()),
+      BenchmarkTable::field("stages",            rk.stages()),
+      BenchmarkTable::field("order",             rk.order()),
+      BenchmarkTable::field("steps",             intervals),
+      BenchmarkTable::field("success",           success),
+      BenchmarkTable::field("time_min_ms",       success ? timer.min_ms() : nan),
+      BenchmarkTable::field("time_median_ms",    success ? timer.median_ms() : nan),
+      BenchmarkTable::field("time_mean_ms",      success ? timer.mean_ms() : nan),
+      BenchmarkTable::field("time_stddev_ms",    success ? timer.stddev_ms() : nan),
+      BenchmarkTable::field("error_inf",         error),
+      BenchmarkTable::field("scd",               digits),
+      BenchmarkTable::field("f_evals",           stats.function_evaluations),
+      BenchmarkTable::field("jf_x_evals",        stats.jacobian_x_evaluations),
+      BenchmarkTable::field("newton_iterations", stats.newton_iterations),
+      BenchmarkTable::field("newton_failures",   stats.newton_failures),
+      BenchmarkTable::field("factorizations",    stats.factorizations)
+    });
+    if (!message.empty()) {
+      std::cerr << problem.name << " - " << rk.name() << " - " << intervals << " steps: " << message << std::endl;
+    }
+  }
+}
+
+// Run the compared implicit methods on the given problem.
+template<typename System>
+void run_all(Problem<System> const &problem, BenchmarkTable &table)
+{
+  run<RadauIIA5>(problem, table);
+  run<GaussLegendre6>(problem, table);
+  run<SSPIRK33>(problem, table);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1) {output_prefix = argv[1];}
+  if (argc > 2) {repetitions = std::max(1, std::atoi(argv[2]));}
+  if (argc > 3) {levels = std::max(1, std::atoi(argv[3]));}
+
+  BenchmarkTable table("stiff");
+
+  // Chemical Akzo Nobel index-1 DAE
+  {
+    Problem<ChemAkzo<Real>> problem;
+    problem.name      = "ChemAkzo";
+    problem.system    = std::make_shared<ChemAkzo<Real>>();
+    problem.ics       = problem.system->ics();
+    problem.intervals = 180;
+    problem.decades   = 3.0;
+    problem.reference <<
+      0.1150794920661702e+0,
+      0.1203831471567715e-2,
+      0.1611562887407974e+0,
+      0.3656156421249283e-3,
+      0.1708010885264404e-1,
+      0.4873531310307455e-2;
+    run_all(problem, table);
+  }
+
+  // High irradiance responses of photomorphogenesis
+  {
+    Problem<HIRES<Real>> problem;
+    problem.name      = "HIRES";
+    problem.system    = std::make_shared<HIRES<Real>>();
+    problem.ics       = problem.system->ics();
+    problem.intervals = 200;
+    problem.decades   = 4.0;
+    problem.reference <<
+      0.7371312573325668e-3,
+      0.1442485726316185e-3,
+      0.5888729740967575e-4,
+      0.1175651343283149e-2,
+      0.2386356198831331e-2,
+      0.6238968252742796e-2,
+      0.2849998395185769e-2,
+      0.2850001604814231e-2;
+    run_all(problem, table);
+  }
+
+  // Robertson chemical reaction over a very long time interval
+  {
+    Problem<Robertson<Real>> problem;
+    problem.name      = "Robertson";
+    problem.system    = std::make_shared<Robertson<Real>>();
+    problem.ics       = problem.system->ics();
+    problem.intervals = 200;
+    problem.decades   = 17.0;
+    problem.reference <<
+      0.2083340149701255e-7,
+      0.8333360770334713e-13,
+      0.9999999791665050e+0;
+    run_all(problem, table);
+  }
+
+  // Van der Pol oscillator in the singularly perturbed form
+  {
+    Problem<VanDerPol<Real>> problem;
+    problem.name      = "VanDerPol";
+    problem.system    = std::make_shared<VanDerPol<Real>>();
+    problem.ics       = problem.system->ics();
+    problem.intervals = 500;
+    problem.decades   = 0.0;
+    problem.reference <<
+      0.1763234540203446e+1,
+      -0.8356886816776778e+0;
+    run_all(problem, table);
+  }
+
+  // Air pollution model of the Dutch National Institute of Public Health
+  {
+    Problem<Pollution<Real>> problem;
+    problem.name      = "Pollution";
+    problem.system    = std::make_shared<Pollution<Real>>();
+    problem.ics       = problem.system->ics();
+    problem.intervals = 100;
+    problem.decades   = 6.0;
+    problem.reference <<
+      0.5646255480022769e-1,
+      0.1342484130422339e+0,
+      0.4139734331099427e-8,
+      0.5523140207484359e-2,
+      0.2018977262302196e-6,
+      0.1464541863493966e-6,
+      0.7784249118997964e-1,
+      0.3245075353396018e+0,
+      0.7494013383880406e-2,
+      0.1622293157301561e-7,
+      0.1135863833257075e-7,
+      0.2230505975721359e-2,
+      0.2087162882798630e-3,
+      0.1396921016840158e-4,
+      0.8964884856898295e-2,
+      0.4352846369330103e-17,
+      0.6899219696263405e-2,
+      0.1007803037365946e-3,
+      0.1772146513969984e-5,
+      0.5682943292316392e-4;
+    run_all(problem, table);
+  }
+
+  // Andrews' squeezing mechanism (index-1 form)
+  {
+    Problem<Andrews<Real>> problem;
+    problem.name      = "Andrews";
+    problem.system    = std::make_shared<Andrews<Real>>();
+    problem.ics       = problem.system->ics();
+    problem.intervals = 100;
+    problem.decades   = 0.0;
+    problem.reference <<
+      0.1581077119515410e+2,
+      -0.1575637105841233e+2,
+      0.4082224011964194e-1,
+      -0.5347301163420966e+0,
+      0.5244099658799547e+0,
+      0.5347301163420898e+0,
+      0.1048080741041939e+1,
+      0.1139920302259091e+4,
+      -0.1424379295177512e+4,
+      0.1103291191072971e+2,
+      0.1929337410522565e+2,
+      0.5735699148353843e+0,
+      -0.1929337410522601e+2,
+      0.3231791492522862e+0,
+      0.1991753481045277e+3,
+      -0.2975530997500214e+2,
+      0.2306654361162091e+2,
+      0.3145272527577305e+2,
+      0.2264249478639249e+2,
+      0.1161739235261250e+2;
+    run_all(problem, table);
+  }
+
+  // Car axis multibody model (index-1 form)
+  {
+    Problem<CarAxis<Real>> problem;
+    problem.name      = "CarAxis";
+    problem.system    = std::make_shared<CarAxis<Real>>();
+    problem.ics       = problem.system->ics();
+    problem.intervals = 150;
+    problem.decades   = 0.0;
+    problem.reference <<
+      0.4934557842752709e-1,
+      0.4969894602300052e+0,
+      0.1041742524885467e+1,
+      0.3739110272653402e+0,
+      -0.7705836840359072e-1,
+      0.7446866592039427e-2,
+      0.1755681575339372e-1,
+      0.7703410437780197e+0,
+      -0.4736886590853430e-2,
+      -0.1104680331259580e-2;
+    run_all(problem, table);
+  }
+
+  // Ring modulator electrical circuit
+  {
+    Problem<RingModulator<Real>> problem;
+    problem.name      = "RingModulator";
+    problem.system    = std::make_shared<RingModulator<Real>>();
+    problem.ics       = problem.system->ics();
+    problem.intervals = 5000;
+    problem.decades   = 0.0;
+    problem.reference <<
+      -0.2339057358437402e-1,
+      -0.7367485486007743e-2,
+      0.2582956709994026e+0,
+      -0.4064465720583862e+0,
+      -0.4039455664453247e+0,
+      0.2607966766128534e+0,
+      0.1106761861273311e+0,
+      0.2939904342424862e-6,
+      -0.2840029933065175e-7,
+      0.7267198267291328e-3,
+      0.7929487197023410e-3,
+      -0.7255283495766213e-3,
+      -0.7941401968548928e-3,
+      0.7088495416875722e-4,
+      0.2390059075277135e-4;
+    run_all(problem, table);
+  }
+
+  table.print(std::cout);
+  if (!table.write(output_prefix)) {
+    std::cerr << "Unable to write the results with prefix '" << output_prefix << "'." << std::endl;
+    return 1;
+  }
+  return 0;
+}
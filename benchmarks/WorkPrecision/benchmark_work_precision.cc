@@ -0,0 +1,226 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "Sandals.hh"
+#include "Sandals/TicToc.hh"
+
+#include "Sandals/RungeKutta/Chebyshev51.hh"
+#include "Sandals/RungeKutta/ExplicitEuler.hh"
+#include "Sandals/RungeKutta/Fehlberg45.hh"
+#include "Sandals/RungeKutta/GaussLegendre2.hh"
+#include "Sandals/RungeKutta/GaussLegendre4.hh"
+#include "Sandals/RungeKutta/GaussLegendre6.hh"
+#include "Sandals/RungeKutta/Heun2.hh"
+#include "Sandals/RungeKutta/Heun3.hh"
+#include "Sandals/RungeKutta/LobattoIIIA2.hh"
+#include "Sandals/RungeKutta/ImplicitEuler.hh"
+#include "Sandals/RungeKutta/MTE22.hh"
+#include "Sandals/RungeKutta/RadauIIA3.hh"
+#include "Sandals/RungeKutta/RadauIIA5.hh"
+#include "Sandals/RungeKutta/Ralston2.hh"
+#include "Sandals/RungeKutta/Ralston3.hh"
+#include "Sandals/RungeKutta/Ralston4.hh"
+#include "Sandals/RungeKutta/RK4.hh"
+#include "Sandals/RungeKutta/SSPIRK33.hh"
+#include "Sandals/RungeKutta/SSPRK22.hh"
+#include "Sandals/RungeKutta/SSPRK22star.hh"
+#include "Sandals/RungeKutta/SSPRK33.hh"
+#include "Sandals/RungeKutta/SSPRK42.hh"
+#include "Sandals/RungeKutta/SSPRK43.hh"
+#include "Sandals/RungeKutta/SSPRK93.hh"
+#include "Sandals/RungeKutta/SSPRK104.hh"
+
+#include "OscillatorExplicit.hh"
+#include "OscillatorImplicit.hh"
+#include "SinCosExplicit.hh"
+
+#include "Benchmark.hh"
+
+using namespace Sandals;
+using Real = double;
+
+// Work-precision problem, i.e., a system with an analytical solution, its initial conditions and
+// the suggested integration mesh.
+template<typename System>
+struct Problem
+{
+  static constexpr Integer N{System::VectorF::RowsAtCompileTime};
+  static constexpr Integer M{System::VectorH::RowsAtCompileTime};
+
+  using VectorN = Eigen::Vector<Real, N>;
+  using VectorX = Eigen::Vector<Real, Eigen::Dynamic>;
+
+  std::string             name;   // Problem name
+  std::shared_ptr<System> system; // System to be integrated
+  VectorN                 ics;    // Initial conditions
+  VectorX                 mesh;   // Suggested integration mesh
+};
+
+// Benchmark settings
+static Integer     warm_up{1};                             // Untimed warm-up runs
+static Integer     repetitions{3};                         // Timed repetitions per run
+static std::string output_prefix{"benchmark_work_precision"}; // Output files prefix
+static Real        tolerance_max{1.0e-3};                  // Loosest tolerance of the sweep
+static Real        tolerance_min{1.0e-10};                 // Tightest tolerance of the sweep
+static Integer     tolerance_points{15};                   // Tolerances in the logarithmic grid
+
+// Solve the problem with the given embedded method over the logarithmic grid of tolerances and
+// append a row per tolerance to the table. The absolute and relative tolerances are set to the
+// same value. The error is measured against the analytical solution, both at the last computed
+// point (final error) and over all the computed points (global error).
+template<template<typename, Integer, Integer> class Method, typename System>
+void sweep(Problem<System> const &problem, BenchmarkTable &table)
+{
+  constexpr Integer N{Problem<System>::N};
+  constexpr Integer M{Problem<System>::M};
+
+  Method<Real, N, M> rk(problem.system);
+  if (!rk.is_embedded()) {return;}
+
+  Solution<Real, N, M> sol;
+  TicToc<Real> timer(warm_up);
+  for (Integer k{0}; k < tolerance_points; ++k) {
+    Real tolerance{tolerance_max * std::pow(tolerance_min/tolerance_max,
+      static_cast<Real>(k)/static_cast<Real>(std::max(1, tolerance_points-1)))};
+    rk.absolute_tolerance(tolerance);
+    rk.relative_tolerance(tolerance);
+
+    timer.reset();
+    bool success{true};
+    std::string message;
+    try {
+      for (Integer i{0}; i < warm_up + repetitions; ++i) {
+        timer.tic();
+        success = rk.adaptive_solve(problem.mesh, problem.ics, sol);
+        timer.toc();
+        if (!success) {break;}
+      }
+    } catch (std::exception const &e) {
+      success = false;
+      message = e.what();
+    }
+
+    Real error_final{std::numeric_limits<Real>::quiet_NaN()}, error_global{0.0};
+    if (success && sol.size() > 0) {
+      for (Integer i{0}; i < sol.size(); ++i) {
+        error_global = std::max(error_global, (sol.x.col(i) -
+          problem.system->analytical_solution(sol.t(i))).template lpNorm<Eigen::Infinity>());
+      }
+      error_final = (sol.x.col(sol.size()-1) -
+        problem.system->analytical_solution(sol.t(sol.size()-1))).template lpNorm<Eigen::Infinity>();
+    } else {
+      success = false;
+    }
+
+    Statistics const &stats = rk.statistics();
+    Real const nan{std::numeric_limits<Real>::quiet_NaN()};
+    table.add_row({
+      BenchmarkTable::field("system",            problem.name),
+      BenchmarkTable::field("method",            rk.name()),
+      BenchmarkTable::field("order",             rk.order()),
+      BenchmarkTable::field("tolerance",         tolerance),
+      BenchmarkTable::field("success",           success),
+      BenchmarkTable::field("steps",             success ? sol.size()-1 : 0),
+      BenchmarkTable::field("time_min_ms",       success ? timer.min_ms() : nan),
+      BenchmarkTable::field("time_median_ms",    success ? timer.median_ms() : nan),
+      BenchmarkTable::field("time_mean_ms",      success ? timer.mean_ms() : nan),
+      BenchmarkTable::field("time_stddev_ms",    success ? timer.stddev_ms() : nan),
+      BenchmarkTable::field("error_final",       success ? error_final : nan),
+      BenchmarkTable::field("error_global",      success ? error_global : nan),
+      BenchmarkTable::field("f_evals",           stats.function_evaluations),
+      BenchmarkTable::field("jf_x_evals",        stats.jacobian_x_evaluations),
+      BenchmarkTable::field("jf_x_dot_evals",    stats.jacobian_x_dot_evaluations),
+      BenchmarkTable::field("newton_iterations", stats.newton_iterations),
+      BenchmarkTable::field("factorizations",    stats.factorizations),
+      BenchmarkTable::field("accepted_steps",    stats.accepted_steps),
+      BenchmarkTable::field("rejected_steps",    stats.rejected_steps)
+    });
+    if (!message.empty()) {
+      std::cerr << problem.name << " - " << rk.name() << " - tol " << tolerance << ": " << message << std::endl;
+    }
+  }
+}
+
+// Sweep every embedded method on the given problem, the non-embedded ones are skipped.
+template<typename System>
+void sweep_all(Problem<System> const &problem, BenchmarkTable &table)
+{
+  sweep<Chebyshev51>(problem, table);
+  sweep<ExplicitEuler>(problem, table);
+  sweep<Fehlberg45>(problem, table);
+  sweep<GaussLegendre2>(problem, table);
+  sweep<GaussLegendre4>(problem, table);
+  sweep<GaussLegendre6>(problem, table);
+  sweep<Heun2>(problem, table);
+  sweep<Heun3>(problem, table);
+  sweep<LobattoIIIA2>(problem, table);
+  sweep<ImplicitEuler>(problem, table);
+  sweep<MTE22>(problem, table);
+  sweep<RadauIIA3>(problem, table);
+  sweep<RadauIIA5>(problem, table);
+  sweep<Ralston2>(problem, table);
+  sweep<Ralston3>(problem, table);
+  sweep<Ralston4>(problem, table);
+  sweep<RK4>(problem, table);
+  sweep<SSPIRK33>(problem, table);
+  sweep<SSPRK22>(problem, table);
+  sweep<SSPRK22star>(problem, table);
+  sweep<SSPRK33>(problem, table);
+  sweep<SSPRK42>(problem, table);
+  sweep<SSPRK43>(problem, table);
+  sweep<SSPRK93>(problem, table);
+  sweep<SSPRK104>(problem, table);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1) {output_prefix = argv[1];}
+  if (argc > 2) {repetitions = std::max(1, std::atoi(argv[2]));}
+  if (argc > 3) {tolerance_points = std::max(1, std::atoi(argv[3]));}
+
+  BenchmarkTable table("work_precision");
+
+  // Harmonic oscillator (explicit form) with analytical solution
+  {
+    Problem<OscillatorExplicit<Real>> problem;
+    problem.name   = "OscillatorExplicit";
+    problem.system = std::make_shared<OscillatorExplicit<Real>>();
+    problem.ics    = problem.system->ics();
+    problem.mesh   = Eigen::VectorXd::LinSpaced(101, 0.0, 10.0);
+    sweep_all(problem, table);
+  }
+
+  // Harmonic oscillator (implicit form) with analytical solution
+  {
+    Problem<OscillatorImplicit<Real>> problem;
+    problem.name   = "OscillatorImplicit";
+    problem.system = std::make_shared<OscillatorImplicit<Real>>();
+    problem.ics    = problem.system->ics();
+    problem.mesh   = Eigen::VectorXd::LinSpaced(101, 0.0, 10.0);
+    sweep_all(problem, table);
+  }
+
+  // Sine and cosine system with analytical solution
+  {
+    Problem<SinCosExplicit<Real>> problem;
+    problem.name   = "SinCosExplicit";
+    problem.system = std::make_shared<SinCosExplicit<Real>>();
+    problem.ics    = problem.system->ics();
+    problem.mesh   = Eigen::VectorXd::LinSpaced(101, 0.0, 10.0);
+    sweep_all(problem, table);
+  }
+
+  table.print(std::cout);
+  if (!table.write(output_prefix)) {
+    std::cerr << "Unable to write the results with prefix '" << output_prefix << "'." << std::endl;
+    return 1;
+  }
+  return 0;
+}
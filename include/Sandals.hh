@@ -18,6 +18,8 @@
 #include <string>
 #include <cmath>
 #include <vector>
+#include <array>
+#include <complex>
 #include <map>
 #include <memory>
 #include <chrono>
@@ -65,6 +67,25 @@
   }
 #endif
 
+// Statistics update for Sandals (compiled out if SANDALS_ENABLE_STATISTICS is not defined)
+#ifndef SANDALS_STATISTICS
+#ifdef SANDALS_ENABLE_STATISTICS
+#define SANDALS_STATISTICS(CMD) CMD
+#else
+#define SANDALS_STATISTICS(CMD)
+#endif
+#endif
+
+// Tracing scope for Sandals (compiled out if SANDALS_ENABLE_TRACING is not defined)
+#ifndef SANDALS_TRACE_SCOPE
+#ifdef SANDALS_ENABLE_TRACING
+#define SANDALS_TRACE_SCOPE(TRACER, PHASE) \
+  Sandals::TraceScope sandals_trace_scope(TRACER, Sandals::Tracer::Phase::PHASE)
+#else
+#define SANDALS_TRACE_SCOPE(TRACER, PHASE)
+#endif
+#endif
+
 // Define the basic constants for Sandals
 #ifndef SANDALS_BASIC_CONSTANTS
 #define SANDALS_BASIC_CONSTANTS(Real) \
@@ -0,0 +1,194 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#ifndef SANDALS_LINEARSOLVER_HH
+#define SANDALS_LINEARSOLVER_HH
+
+#include <type_traits>
+
+#include <Sandals.hh>
+
+#include <Eigen/Sparse>
+
+namespace Sandals {
+
+  /*\
+   |   _     _                       ____        _
+   |  | |   (_)_ __   ___  __ _ _ __/ ___|  ___ | |_   _____ _ __
+   |  | |   | | '_ \ / _ \/ _` | '__\___ \ / _ \| \ \ / / _ \ '__|
+   |  | |___| | | | |  __/ (_| | |   ___) | (_) | |\ V /  __/ |
+   |  |_____|_|_| |_|\___|\__,_|_|  |____/ \___/|_| \_/ \___|_|
+   |
+  \*/
+
+  /**
+  * \brief Class container for a linear solver policy.
+  *
+  * Class container for a linear solver policy, *i.e.*, a thin adapter around an Eigen dense or
+  * sparse decomposition that factorizes a dense matrix \f$ \mathbf{A} \f$, detects if it is
+  * singular, and solves the linear systems \f$ \mathbf{A} \mathbf{x} = \mathbf{b} \f$ with the
+  * stored factorization. The classes using a linear solver take it as a template template
+  * parameter, which is instantiated with the dense matrix type to be factorized. Therefore, a
+  * user-supplied solver can be any class template on the matrix type that provides the methods
+  * \c factorize(A), returning false if \f$ \mathbf{A} \f$ is singular, and \c solve(b).
+  * \tparam Decomposition The Eigen decomposition type.
+  * \tparam Matrix The dense matrix type to be factorized.
+  */
+  template <typename Decomposition, typename Matrix>
+  class LinearSolver
+  {
+  public:
+    using Scalar = typename Matrix::Scalar; /**< Scalar number type. */
+    using Real = typename Eigen::NumTraits<Scalar>::Real; /**< Real number type. */
+
+    SANDALS_BASIC_CONSTANTS(Real) /**< Basic constants. */
+
+  private:
+    Decomposition m_decomposition; /**< Decomposition of the matrix. */
+    bool m_regular{false};         /**< True if the factorized matrix is regular. */
+
+  public:
+    /**
+    * Factorize the matrix \f$ \mathbf{A} \f$.
+    * \param[in] A The matrix \f$ \mathbf{A} \f$.
+    * \return True if the matrix is regular, false if it is singular.
+    */
+    bool factorize(Matrix const & A)
+    {
+      if constexpr (std::is_base_of_v<Eigen::SparseSolverBase<Decomposition>, Decomposition>) {
+        this->m_decomposition.compute(A.sparseView());
+      } else {
+        this->m_decomposition.compute(A);
+      }
+      this->m_regular = check(this->m_decomposition);
+      return this->m_regular;
+    }
+
+    /**
+    * Solve the linear system \f$ \mathbf{A} \mathbf{x} = \mathbf{b} \f$ with the factorized matrix.
+    * \param[in] b The right-hand side \f$ \mathbf{b} \f$.
+    * \return The solution \f$ \mathbf{x} \f$.
+    */
+    template <typename Rhs>
+    auto solve(Eigen::MatrixBase<Rhs> const & b) const {return this->m_decomposition.solve(b);}
+
+    /**
+    * Check if the factorized matrix is regular.
+    * \return True if the factorized matrix is regular, false otherwise.
+    */
+    bool regular() const {return this->m_regular;}
+
+    /**
+    * Get the decomposition of the matrix.
+    * \return The decomposition of the matrix.
+    */
+    Decomposition const & decomposition() const {return this->m_decomposition;}
+
+  private:
+    /**
+    * Check if the (non-negative) pivots of a triangular factor are far from zero, relative to the
+    * largest one.
+    * \param[in] pivots The absolute values of the pivots.
+    * \return True if the pivots are all far from zero, false otherwise.
+    */
+    template <typename Vector>
+    static bool check_pivots(Vector const & pivots)
+    {
+      if (pivots.size() == 0) {return true;}
+      if (!pivots.allFinite()) {return false;}
+      Real max_pivot{pivots.maxCoeff()};
+      return max_pivot > Real(0.0) && pivots.minCoeff() > EPSILON * pivots.size() * max_pivot;
+    }
+
+    /**
+    * Check if a rank-revealing decomposition is regular.
+    * \param[in] d The decomposition.
+    * \return True if the decomposed matrix is regular, false otherwise.
+    */
+    template <typename M> static bool check(Eigen::FullPivLU<M> const & d) {return d.isInvertible();}
+    template <typename M> static bool check(Eigen::ColPivHouseholderQR<M> const & d) {return d.isInvertible();}
+    template <typename M> static bool check(Eigen::FullPivHouseholderQR<M> const & d) {return d.isInvertible();}
+
+    /**
+    * Check if a non rank-revealing decomposition is regular through the pivots of its triangular
+    * factor.
+    * \param[in] d The decomposition.
+    * \return True if the decomposed matrix is regular, false otherwise.
+    */
+    template <typename M> static bool check(Eigen::PartialPivLU<M> const & d)
+      {return check_pivots(d.matrixLU().diagonal().cwiseAbs());}
+    template <typename M> static bool check(Eigen::HouseholderQR<M> const & d)
+      {return check_pivots(d.matrixQR().diagonal().cwiseAbs());}
+    template <typename M, int UpLo> static bool check(Eigen::LDLT<M, UpLo> const & d)
+      {return d.info() == Eigen::Success && check_pivots(d.vectorD().cwiseAbs());}
+
+    /**
+    * Check if a generic decomposition (*e.g.*, Cholesky or sparse) is successfully computed.
+    * \param[in] d The decomposition.
+    * \return True if the decomposition is successfully computed, false otherwise.
+    */
+    template <typename D> static bool check(D const & d) {return d.info() == Eigen::Success;}
+
+  }; // class LinearSolver
+
+  /**
+  * \brief LU decomposition with full pivoting (rank-revealing, the most robust and expensive).
+  * \tparam Matrix The dense matrix type to be factorized.
+  */
+  template <typename Matrix>
+  using FullPivLUSolver = LinearSolver<Eigen::FullPivLU<Matrix>, Matrix>;
+
+  /**
+  * \brief LU decomposition with partial pivoting (for generic regular matrices).
+  * \tparam Matrix The dense matrix type to be factorized.
+  */
+  template <typename Matrix>
+  using PartialPivLUSolver = LinearSolver<Eigen::PartialPivLU<Matrix>, Matrix>;
+
+  /**
+  * \brief Robust Cholesky decomposition \f$ \mathbf{LDL}^\top \f$ (for symmetric matrices).
+  * \tparam Matrix The dense matrix type to be factorized.
+  */
+  template <typename Matrix>
+  using LDLTSolver = LinearSolver<Eigen::LDLT<Matrix>, Matrix>;
+
+  /**
+  * \brief Cholesky decomposition \f$ \mathbf{LL}^\top \f$ (for symmetric positive definite matrices).
+  * \tparam Matrix The dense matrix type to be factorized.
+  */
+  template <typename Matrix>
+  using LLTSolver = LinearSolver<Eigen::LLT<Matrix>, Matrix>;
+
+  /**
+  * \brief Householder QR decomposition (for generic regular matrices).
+  * \tparam Matrix The dense matrix type to be factorized.
+  */
+  template <typename Matrix>
+  using HouseholderQRSolver = LinearSolver<Eigen::HouseholderQR<Matrix>, Matrix>;
+
+  /**
+  * \brief Householder QR decomposition with column pivoting (rank-revealing).
+  * \tparam Matrix The dense matrix type to be factorized.
+  */
+  template <typename Matrix>
+  using ColPivHouseholderQRSolver = LinearSolver<Eigen::ColPivHouseholderQR<Matrix>, Matrix>;
+
+  /**
+  * \brief Sparse supernodal LU decomposition (for large matrices with few non-zeros).
+  * \tparam Matrix The dense matrix type to be factorized.
+  */
+  template <typename Matrix>
+  using SparseLUSolver = LinearSolver<Eigen::SparseLU<Eigen::SparseMatrix<typename Matrix::Scalar>>, Matrix>;
+
+} // namespace Sandals
+
+#endif // SANDALS_LINEARSOLVER_HH
@@ -13,7 +13,10 @@
 #ifndef SANDALS_RUNGEKUTTA_HH
 #define SANDALS_RUNGEKUTTA_HH
 
+#include <atomic>
+#include <exception>
 #include <optional>
+#include <thread>
 
 #include <Sandals.hh>
 
@@ -24,6 +27,8 @@
 
 #include <Sandals/Tableau.hh>
 #include <Sandals/Solution.hh>
+#include <Sandals/Statistics.hh>
+#include <Sandals/Tracer.hh>
 
 namespace Sandals {
 
@@ -62,12 +67,31 @@ namespace Sandals {
     using NewtonK = Optimist::RootFinder::Newton<Real, N*S>; /**< Templetized Newton solver for IRK methods. */
     using VectorS = typename Tableau<Real, S>::Vector; /**< Templetized vector type. */
     using MatrixS = typename Tableau<Real, S>::Matrix; /**< Templetized matrix type. */
+    using VectorSC = typename Tableau<Real, S>::VectorC; /**< Templetized complex vector type. */
+    using Complex = std::complex<Real>; /**< Complex number type. */
+    using VectorNC = Eigen::Vector<Complex, N>; /**< Templetized complex vector type. */
+    using MatrixNC = Eigen::Matrix<Complex, N, N>; /**< Templetized complex matrix type. */
     using VectorN = typename Implicit<Real, N, M>::VectorF; /**< Templetized vector type. */
     using MatrixN = typename Implicit<Real, N, M>::MatrixJF; /**< Templetized matrix type. */
     using VectorM = typename Implicit<Real, N, M>::VectorH; /**< Templetized vector type. */
     using MatrixM = typename Implicit<Real, N, M>::MatrixJH; /**< Templetized matrix type. */
     using FunctionSC = std::function<void(Integer const, VectorX const &, Real const)>; /**< Step callback function type. */
 
+    /**
+    * \brief Step data shared with the nonlinear solver callbacks.
+    *
+    * The callbacks capture only \c this and a reference to this structure, so that they fit in the
+    * small-buffer storage of \c std::function and wrapping them never touches the heap.
+    */
+    struct StepData
+    {
+      VectorN const & x; /**< States \f$ \mathbf{x}_k \f$ at the \f$ k \f$-th step. */
+      Real t;            /**< Independent variable (or time) \f$ t_k \f$ at the \f$ k \f$-th step. */
+      Real h;            /**< Advancing step \f$ h_k \f$ at the \f$ k \f$-th step. */
+      MatrixK & K;       /**< Variables \f$ \mathbf{K} \f$ of the Runge-Kutta method. */
+      Integer s;         /**< Stage index (ERK and DIRK methods only). */
+    };
+
   public:
     SANDALS_BASIC_CONSTANTS(Real) /**< Basic constants. */
     const Real SQRT_EPSILON{std::sqrt(EPSILON)}; /**< Square root of machine epsilon epsilon static constant value. */ \
@@ -80,6 +104,8 @@ namespace Sandals {
     mutable NewtonX m_newtonX;                     /**< Newton solver for ERK and DIRK methods. */
     mutable NewtonK m_newtonK;                     /**< Newton solver for IRK methods. */
     mutable Eigen::FullPivLU<MatrixP> m_lu;        /**< LU decomposition for the projection matrix. */
+    mutable Statistics m_statistics;               /**< Work counters of the last integration. */
+    mutable Tracer m_tracer;                       /**< Timing histograms of the last integration. */
 
     Tableau<Real, S> m_tableau;                    /**< Butcher tableau of the Runge-Kutta method. */
     System     m_system;                           /**< ODE/DAE system object pointer. */
@@ -99,6 +125,30 @@ namespace Sandals {
     Integer m_max_projection_iterations{5};       /**< Maximum number of projection steps. */
     bool    m_projection{true};                   /**< Adaptive step mode boolean. */
 
+    Real    m_newton_tolerance{EPSILON_HIGH};     /**< Simplified Newton tolerance \f$ \epsilon_{\text{newt}} \f$. */
+    Integer m_max_newton_iterations{20};          /**< Maximum number of simplified Newton iterations. */
+    Real    m_jacobian_contraction{0.1};          /**< Contraction rate \f$ \theta_{\max} \f$ above which the Jacobian is refreshed. */
+    Real    m_refactorization_ratio{0.2};         /**< Relative step change \f$ \rho \f$ above which the iteration matrix is refactorized. */
+    bool    m_simplified_newton{true};            /**< Simplified Newton mode boolean. */
+    bool    m_predictor{true};                    /**< Stage predictor mode boolean. */
+
+    mutable MatrixN m_JF_x;                                   /**< Frozen Jacobian \f$ \mathbf{JF}_x \f$ of the simplified Newton method. */
+    mutable MatrixN m_JF_x_dot;                               /**< Frozen Jacobian \f$ \mathbf{JF}_{x^\prime} \f$ of the simplified Newton method. */
+    mutable Eigen::PartialPivLU<MatrixJ> m_luK;               /**< LU decomposition of the IRK iteration matrix (if not transformed). */
+    mutable std::array<Eigen::PartialPivLU<MatrixN>, S> m_luX; /**< LU decompositions of the DIRK stage (or of the transformed real IRK) iteration matrices. */
+    mutable std::array<Eigen::PartialPivLU<MatrixNC>, S/2> m_luC; /**< LU decompositions of the transformed complex IRK iteration matrices. */
+    mutable MatrixS m_T;                                      /**< IRK transformation matrix \f$ \mathbf{T} \f$. */
+    mutable MatrixS m_T_inv;                                  /**< IRK inverse transformation matrix \f$ \mathbf{T}^{-1} \f$. */
+    mutable VectorSC m_lambda;                                /**< Eigenvalues of the matrix \f$ \mathbf{A} \f$. */
+    mutable bool m_transformed{false};                        /**< True if the IRK iteration matrix is transformed. */
+    mutable Real m_newton_step{0.0};                          /**< Step of the factorized iteration matrix (zero if none). */
+    mutable Real m_newton_contraction{0.0};                   /**< Largest contraction rate of the last simplified Newton solve. */
+    mutable bool m_jacobian_available{false};                 /**< True if the frozen Jacobians are available. */
+    mutable bool m_jacobian_current{false};                   /**< True if the frozen Jacobians are evaluated at the current step. */
+    mutable MatrixK m_predictor_K;                            /**< Variables \f$ \tilde{\mathbf{K}} \f$ of the last accepted step. */
+    mutable Real m_predictor_t{0.0};                          /**< Independent variable (or time) at the end of the last accepted step. */
+    mutable Real m_predictor_h{0.0};                          /**< Advancing step of the last accepted step (zero if none). */
+
   public:
     /**
     * Copy constructor for the timer.
@@ -153,6 +203,12 @@ namespace Sandals {
     */
     bool is_dirk() const {return this->m_tableau.type == Type::DIRK;}
 
+    /**
+    * Check if the method is a singly diagonally implicit Runge-Kutta (SDIRK) method.
+    * \return True if the method is a singly diagonally implicit Runge-Kutta method, false otherwise.
+    */
+    bool is_sdirk() const {return this->m_tableau.is_sdirk();}
+
     /**
     * Get the Butcher Tableau reference.
     * \return The Tableau reference.
@@ -223,7 +279,7 @@ namespace Sandals {
     * Set the ODE/DAE system pointer.
     * \param[in] t_system The ODE/DAE system pointer.
     */
-    void system(System t_system) {this->m_system = t_system;}
+    void system(System t_system) {this->m_system = t_system; this->reset_jacobian(); this->reset_predictor();}
 
     /**
     * Set the implicit ODE/DAE system with lambda functions.
@@ -242,7 +298,7 @@ namespace Sandals {
       typename ImplicitWrapper<Real, N, M>::FunctionJH Jh_x = ImplicitWrapper<Real, N, M>::DefaultJH,
       typename ImplicitWrapper<Real, N, M>::FunctionID in_domain = ImplicitWrapper<Real, N, M>::DefaultID
     ) {
-      this->m_system = std::make_shared<ImplicitWrapper<Real, N, M>>(F, JF_x, JF_x_dot, h, Jh_x, in_domain);
+      this->system(std::make_shared<ImplicitWrapper<Real, N, M>>(F, JF_x, JF_x_dot, h, Jh_x, in_domain));
     }
 
     /**
@@ -264,7 +320,7 @@ namespace Sandals {
       typename ImplicitWrapper<Real, N, M>::FunctionJH Jh_x = ImplicitWrapper<Real, N, M>::DefaultJH,
       typename ImplicitWrapper<Real, N, M>::FunctionID in_domain = ImplicitWrapper<Real, N, M>::DefaultID
     ) {
-      this->m_system = std::make_shared<ImplicitWrapper<Real, N, M>>(name, F, JF_x, JF_x_dot, h, Jh_x, in_domain);
+      this->system(std::make_shared<ImplicitWrapper<Real, N, M>>(name, F, JF_x, JF_x_dot, h, Jh_x, in_domain));
     }
 
     /**
@@ -282,7 +338,7 @@ namespace Sandals {
       typename ExplicitWrapper<Real, N, M>::FunctionJH Jh_x = ExplicitWrapper<Real, N, M>::DefaultJH,
       typename ExplicitWrapper<Real, N, M>::FunctionID in_domain = ExplicitWrapper<Real, N, M>::DefaultID
     ) {
-      this->m_system = std::make_shared<ExplicitWrapper<Real, N, M>>(f, Jf_x, h, Jh_x, in_domain);
+      this->system(std::make_shared<ExplicitWrapper<Real, N, M>>(f, Jf_x, h, Jh_x, in_domain));
     }
 
     /**
@@ -302,7 +358,7 @@ namespace Sandals {
       typename ExplicitWrapper<Real, N, M>::FunctionJH Jh_x = ExplicitWrapper<Real, N, M>::DefaultJH,
       typename ExplicitWrapper<Real, N, M>::FunctionID in_domain = ExplicitWrapper<Real, N, M>::DefaultID
     ) {
-      this->m_system = std::make_shared<ExplicitWrapper<Real, N, M>>(name, f, Jf_x, h, Jh_x, in_domain);
+      this->system(std::make_shared<ExplicitWrapper<Real, N, M>>(name, f, Jf_x, h, Jh_x, in_domain));
     }
 
     /**
@@ -322,7 +378,7 @@ namespace Sandals {
       typename LinearWrapper<Real, N, M>::FunctionJH Jh_x = LinearWrapper<Real, N, M>::DefaultJH,
       typename LinearWrapper<Real, N, M>::FunctionID in_domain = LinearWrapper<Real, N, M>::DefaultID
     ) {
-      this->m_system = std::make_shared<LinearWrapper<Real, N, M>>(E, A, b, h, Jh_x, in_domain);
+      this->system(std::make_shared<LinearWrapper<Real, N, M>>(E, A, b, h, Jh_x, in_domain));
     }
 
     /**
@@ -344,7 +400,7 @@ namespace Sandals {
       typename LinearWrapper<Real, N, M>::FunctionJH Jh_x = LinearWrapper<Real, N, M>::DefaultJH,
       typename LinearWrapper<Real, N, M>::FunctionID in_domain = LinearWrapper<Real, N, M>::DefaultID
     ) {
-      this->m_system = std::make_shared<LinearWrapper<Real, N, M>>(name, E, A, b, h, Jh_x, in_domain);
+      this->system(std::make_shared<LinearWrapper<Real, N, M>>(name, E, A, b, h, Jh_x, in_domain));
     }
 
     /**
@@ -366,7 +422,7 @@ namespace Sandals {
       typename SemiExplicitWrapper<Real, N, M>::FunctionJH Jh_x = SemiExplicitWrapper<Real, N, M>::DefaultJH,
       typename SemiExplicitWrapper<Real, N, M>::FunctionID in_domain = SemiExplicitWrapper<Real, N, M>::DefaultID
     ) {
-      this->m_system = std::make_shared<SemiExplicitWrapper<Real, N, M>>(A, TA_x, b, Jb_x, h, Jh_x, in_domain);
+      this->system(std::make_shared<SemiExplicitWrapper<Real, N, M>>(A, TA_x, b, Jb_x, h, Jh_x, in_domain));
     }
 
     /**
@@ -390,7 +446,7 @@ namespace Sandals {
       typename SemiExplicitWrapper<Real, N, M>::FunctionJH Jh_x = SemiExplicitWrapper<Real, N, M>::DefaultJH,
       typename SemiExplicitWrapper<Real, N, M>::FunctionID in_domain = SemiExplicitWrapper<Real, N, M>::DefaultID
     ) {
-      this->m_system = std::make_shared<SemiExplicitWrapper<Real, N, M>>(name, A, TA_x, b, Jb_x, h, Jh_x, in_domain);
+      this->system(std::make_shared<SemiExplicitWrapper<Real, N, M>>(name, A, TA_x, b, Jb_x, h, Jh_x, in_domain));
     }
 
     /**
@@ -613,6 +669,155 @@ namespace Sandals {
     */
     void disable_projection() {this->m_projection = false;}
 
+    /**
+    * Get the simplified Newton mode, *i.e.*, if the stage equations of the IRK and DIRK methods are
+    * solved with a frozen iteration matrix, whose factorization is reused across the iterations and
+    * the steps, instead of the full Newton method.
+    * \return The simplified Newton mode.
+    */
+    bool simplified_newton() {return this->m_simplified_newton;}
+
+    /**
+    * Set the simplified Newton mode.
+    * \param[in] t_simplified_newton The simplified Newton mode.
+    */
+    void simplified_newton(bool t_simplified_newton)
+      {this->m_simplified_newton = t_simplified_newton; this->reset_jacobian();}
+
+    /**
+    * Enable the simplified Newton mode.
+    */
+    void enable_simplified_newton() {this->simplified_newton(true);}
+
+    /**
+    * Disable the simplified Newton mode (the full Newton method is used).
+    */
+    void disable_simplified_newton() {this->simplified_newton(false);}
+
+    /**
+    * Get the simplified Newton tolerance \f$ \epsilon_{\text{newt}} \f$.
+    * \return The simplified Newton tolerance \f$ \epsilon_{\text{newt}} \f$.
+    */
+    Real newton_tolerance() {return this->m_newton_tolerance;}
+
+    /**
+    * Set the simplified Newton tolerance \f$ \epsilon_{\text{newt}} \f$.
+    * \param[in] t_newton_tolerance The simplified Newton tolerance \f$ \epsilon_{\text{newt}} \f$.
+    */
+    void newton_tolerance(Real const t_newton_tolerance) {this->m_newton_tolerance = t_newton_tolerance;}
+
+    /**
+    * Get the maximum number of simplified Newton iterations.
+    * \return The maximum number of simplified Newton iterations.
+    */
+    Integer & max_newton_iterations() {return this->m_max_newton_iterations;}
+
+    /**
+    * Set the maximum number of simplified Newton iterations.
+    * \param[in] t_max_newton_iterations The maximum number of simplified Newton iterations.
+    */
+    void max_newton_iterations(Integer const t_max_newton_iterations)
+      {this->m_max_newton_iterations = t_max_newton_iterations;}
+
+    /**
+    * Get the contraction rate \f$ \theta_{\max} \f$ above which the frozen Jacobian of the
+    * simplified Newton method is refreshed at the next step.
+    * \return The contraction rate \f$ \theta_{\max} \f$.
+    */
+    Real jacobian_contraction() {return this->m_jacobian_contraction;}
+
+    /**
+    * Set the contraction rate \f$ \theta_{\max} \f$ above which the frozen Jacobian of the
+    * simplified Newton method is refreshed at the next step.
+    * \param[in] t_jacobian_contraction The contraction rate \f$ \theta_{\max} \f$.
+    */
+    void jacobian_contraction(Real const t_jacobian_contraction)
+      {this->m_jacobian_contraction = t_jacobian_contraction;}
+
+    /**
+    * Get the relative step change \f$ \rho \f$ above which the iteration matrix of the simplified
+    * Newton method is refactorized, *i.e.*, the factorization is reused as long as \f$ |h_k/h_{
+    * \text{fact}} - 1| \leq \rho \f$.
+    * \return The relative step change \f$ \rho \f$.
+    */
+    Real refactorization_ratio() {return this->m_refactorization_ratio;}
+
+    /**
+    * Set the relative step change \f$ \rho \f$ above which the iteration matrix of the simplified
+    * Newton method is refactorized.
+    * \param[in] t_refactorization_ratio The relative step change \f$ \rho \f$.
+    */
+    void refactorization_ratio(Real const t_refactorization_ratio)
+      {this->m_refactorization_ratio = t_refactorization_ratio;}
+
+    /**
+    * Discard the frozen Jacobians and the iteration matrix factorizations of the simplified Newton
+    * method, so that they are re-evaluated at the next implicit step.
+    */
+    void reset_jacobian() const
+    {
+      this->m_jacobian_available = false;
+      this->m_jacobian_current   = false;
+      this->m_newton_step        = Real(0.0);
+      this->m_newton_contraction = Real(0.0);
+    }
+
+    /**
+    * Get the stage predictor mode, *i.e.*, if the initial guess of the stage equations of the
+    * implicit steps is extrapolated from the variables \f$ \mathbf{K} \f$ of the last accepted
+    * step, instead of being set to zero.
+    * \return The stage predictor mode.
+    */
+    bool predictor() {return this->m_predictor;}
+
+    /**
+    * Set the stage predictor mode.
+    * \param[in] t_predictor The stage predictor mode.
+    */
+    void predictor(bool t_predictor) {this->m_predictor = t_predictor; this->reset_predictor();}
+
+    /**
+    * Enable the stage predictor mode.
+    */
+    void enable_predictor() {this->predictor(true);}
+
+    /**
+    * Disable the stage predictor mode (the stage equations are solved starting from zero).
+    */
+    void disable_predictor() {this->predictor(false);}
+
+    /**
+    * Discard the variables \f$ \mathbf{K} \f$ of the last accepted step, so that the next implicit
+    * step starts from zero.
+    */
+    void reset_predictor() const {this->m_predictor_h = Real(0.0);}
+
+    /**
+    * Get the work counters of the last integration, *i.e.*, the statistics collected during the
+    * last call to the solve(...) or adaptive_solve(...) methods.
+    * \return The work counters of the last integration.
+    * \note The counters are updated only if \c SANDALS_ENABLE_STATISTICS is defined.
+    */
+    Statistics const & statistics() const {return this->m_statistics;}
+
+    /**
+    * Reset the work counters.
+    */
+    void reset_statistics() const {this->m_statistics.reset();}
+
+    /**
+    * Get the per-phase timing histograms of the last integration, *i.e.*, the timings collected
+    * during the last call to the solve(...) or adaptive_solve(...) methods.
+    * \return The per-phase timing histograms of the last integration.
+    * \note The histograms are updated only if \c SANDALS_ENABLE_TRACING is defined.
+    */
+    Tracer const & tracer() const {return this->m_tracer;}
+
+    /**
+    * Reset the per-phase timing histograms.
+    */
+    void reset_tracer() const {this->m_tracer.reset();}
+
     /**
     * Estimate the optimal step size for the next advancing step according to the error control method.
     * The error control method used is based on the local truncation error, which is computed as
@@ -717,6 +922,8 @@ namespace Sandals {
     bool erk_explicit_step(VectorN const & x_old, Real const t_old, Real const h_old, VectorN & x_new,
       Real & h_new, MatrixK & K) const
     {
+      SANDALS_TRACE_SCOPE(this->m_tracer, ERK_EXPLICIT_STEP);
+
       using Eigen::all;
       using Eigen::seqN;
 
@@ -730,6 +937,7 @@ namespace Sandals {
           K.col(i) = h_old * static_cast<Explicit<Real, N, M> const *>(this->m_system.get())->f_reverse(x_node, t_old + h_old*this->m_tableau.c(i));
         }
       }
+      SANDALS_STATISTICS(this->m_statistics.function_evaluations += S;)
       if (!K.allFinite()) {return false;}
 
       // Perform the step and obtain the next state
@@ -769,6 +977,7 @@ namespace Sandals {
       using Eigen::all;
       using Eigen::seqN;
       VectorN x_node(x + K(all, seqN(0, s)) * this->m_tableau.A(s, seqN(0, s)).transpose());
+      SANDALS_STATISTICS(this->m_statistics.function_evaluations += 1;)
       if (!this->m_reverse) {
         fun = this->m_system->F(x_node, K.col(s)/h, t + h * this->m_tableau.c(s));
       } else {
@@ -813,6 +1022,7 @@ namespace Sandals {
       using Eigen::all;
       using Eigen::seqN;
       VectorN x_node(x + K(all, seqN(0, s)) * this->m_tableau.A(s, seqN(0, s)).transpose());
+      SANDALS_STATISTICS(this->m_statistics.jacobian_x_dot_evaluations += 1;)
       if (!this->m_reverse) {
         jac = this->m_system->JF_x_dot(x_node, K.col(s)/h, t + h * this->m_tableau.c(s)) / h;
       } else {
@@ -837,19 +1047,35 @@ namespace Sandals {
     bool erk_implicit_step(VectorN const & x_old, Real const t_old, Real const h_old, VectorN & x_new,
       Real & h_new, MatrixK & K) const
     {
-      VectorN K_sol;
-      VectorN K_ini(VectorN::Zero());
+      SANDALS_TRACE_SCOPE(this->m_tracer, ERK_IMPLICIT_STEP);
+
+      VectorN K_sol, K_ini;
+      StepData data{x_old, t_old, h_old, K, 0};
+
+      // Predict the initial guess from the last accepted step
+      this->predict(t_old, h_old, K);
 
       // Check if the solver converged
       for (Integer s{0}; s < S; ++s) {
+        data.s = s;
+        K_ini = K.col(s);
         if (this->m_newtonX.solve(
-            [this, s, &K, &x_old, t_old, h_old](VectorN const & K_fun, VectorN & fun)
-              {K.col(s) = K_fun; this->erk_implicit_function(s, x_old, t_old, h_old, K, fun);},
-            [this, s, &K, &x_old, t_old, h_old](VectorN const & K_jac, MatrixN & jac)
-              {K.col(s) = K_jac; this->erk_implicit_jacobian(s, x_old, t_old, h_old, K, jac);},
+            [this, &data](VectorN const & K_fun, VectorN & fun)
+              {
+                data.K.col(data.s) = K_fun;
+                this->erk_implicit_function(data.s, data.x, data.t, data.h, data.K, fun);
+              },
+            [this, &data](VectorN const & K_jac, MatrixN & jac)
+              {
+                SANDALS_STATISTICS(this->m_statistics.newton_iterations += 1;)
+                SANDALS_STATISTICS(this->m_statistics.factorizations += 1;)
+                data.K.col(data.s) = K_jac;
+                this->erk_implicit_jacobian(data.s, data.x, data.t, data.h, data.K, jac);
+              },
             K_ini, K_sol)) {
           K.col(s) = K_sol;
         } else {
+          SANDALS_STATISTICS(this->m_statistics.newton_failures += 1;)
           return false;
         }
       }
@@ -930,6 +1156,7 @@ namespace Sandals {
       VectorN x_node;
       MatrixK K_mat{K.reshaped(N, S)};
       MatrixK fun_mat;
+      SANDALS_STATISTICS(this->m_statistics.function_evaluations += S;)
       for (Integer i{0}; i < S; ++i) {
         x_node = x + K_mat * this->m_tableau.A.row(i).transpose();
         if (!this->m_reverse) {
@@ -990,6 +1217,8 @@ namespace Sandals {
       VectorN x_node, x_dot_node;
       MatrixN JF_x, JF_x_dot;
       auto idx = seqN(0, N), jdx = seqN(0, N);
+      SANDALS_STATISTICS(this->m_statistics.jacobian_x_evaluations += S;)
+      SANDALS_STATISTICS(this->m_statistics.jacobian_x_dot_evaluations += S;)
       for (Integer i{0}; i < S; ++i) {
         t_node = t + h * this->m_tableau.c(i);
         x_node = x + K_mat * this->m_tableau.A.row(i).transpose();
@@ -1034,17 +1263,34 @@ namespace Sandals {
     bool irk_step(VectorN const & x_old, Real const t_old, Real const h_old, VectorN & x_new,
       Real & h_new, MatrixK & K) const
     {
+      SANDALS_TRACE_SCOPE(this->m_tracer, IRK_STEP);
+
       VectorK K_vec;
-      VectorK K_ini(VectorK::Zero());
+      StepData data{x_old, t_old, h_old, K, 0};
+
+      // Predict the initial guess from the last accepted step
+      this->predict(t_old, h_old, K);
+      VectorK K_ini(K.reshaped(N*S, 1));
 
       // Check if the solver converged
-      if (!this->m_newtonK.solve(
-          [this, &x_old, t_old, h_old](VectorK const & K_fun, VectorK & fun)
-            {this->irk_function(x_old, t_old, h_old, K_fun, fun);},
-          [this, &x_old, t_old, h_old](VectorK const & K_jac, MatrixJ & jac)
-            {this->irk_jacobian(x_old, t_old, h_old, K_jac, jac);},
-          K_ini, K_vec))
-        {return false;}
+      if (this->m_simplified_newton) {
+        if (!this->irk_simplified_newton(x_old, t_old, h_old, K_ini, K_vec)) {
+          SANDALS_STATISTICS(this->m_statistics.newton_failures += 1;)
+          return false;
+        }
+      } else if (!this->m_newtonK.solve(
+          [this, &data](VectorK const & K_fun, VectorK & fun)
+            {this->irk_function(data.x, data.t, data.h, K_fun, fun);},
+          [this, &data](VectorK const & K_jac, MatrixJ & jac)
+            {
+              SANDALS_STATISTICS(this->m_statistics.newton_iterations += 1;)
+              SANDALS_STATISTICS(this->m_statistics.factorizations += 1;)
+              this->irk_jacobian(data.x, data.t, data.h, K_jac, jac);
+            },
+          K_ini, K_vec)) {
+        SANDALS_STATISTICS(this->m_statistics.newton_failures += 1;)
+        return false;
+      }
 
       // Reshape the K vector to a matrix
       K = K_vec.reshaped(N, S);
@@ -1096,6 +1342,7 @@ namespace Sandals {
       using Eigen::all;
       using Eigen::seqN;
       VectorN x_node(x + K(all, seqN(0, n+1)) * this->m_tableau.A(n, seqN(0, n+1)).transpose());
+      SANDALS_STATISTICS(this->m_statistics.function_evaluations += 1;)
       if (!this->m_reverse) {
         fun = this->m_system->F(x_node, K.col(n)/h, t + h * this->m_tableau.c(n));
       } else {
@@ -1144,6 +1391,8 @@ namespace Sandals {
       Real t_node{t + h * this->m_tableau.c(n)};
       VectorN x_node(x + K(all, seqN(0, n+1)) * this->m_tableau.A(n, seqN(0, n+1)).transpose());
       VectorN x_dot_node(K.col(n)/h);
+      SANDALS_STATISTICS(this->m_statistics.jacobian_x_evaluations += 1;)
+      SANDALS_STATISTICS(this->m_statistics.jacobian_x_dot_evaluations += 1;)
       if (!this->m_reverse) {
         jac = this->m_tableau.A(n,n) * this->m_system->JF_x(x_node, x_dot_node, t_node) +
           this->m_system->JF_x_dot(x_node, x_dot_node, t_node) / h;
@@ -1170,21 +1419,44 @@ namespace Sandals {
     bool dirk_step(VectorN const & x_old, Real const t_old, Real const h_old, VectorN & x_new,
       Real & h_new, MatrixK & K) const
     {
-      VectorN K_sol;
-      VectorN K_ini(VectorN::Zero());
+      SANDALS_TRACE_SCOPE(this->m_tracer, DIRK_STEP);
+
+      VectorN K_sol, K_ini;
+      StepData data{x_old, t_old, h_old, K, 0};
+
+      // Predict the initial guess from the last accepted step
+      this->predict(t_old, h_old, K);
 
       // Check if the solver converged at each step
-      for (Integer n{0}; n < S; ++n) {
-        if (this->m_newtonX.solve(
-            [this, n, &K, &x_old, t_old, h_old](VectorN const & K_fun, VectorN & fun)
-              {K.col(n) = K_fun; this->dirk_function(n, x_old, t_old, h_old, K, fun);},
-            [this, n, &K, &x_old, t_old, h_old](VectorN const & K_jac, MatrixN & jac)
-              {K.col(n) = K_jac; this->dirk_jacobian(n, x_old, t_old, h_old, K, jac);},
-            K_ini, K_sol)) {
+      if (this->m_simplified_newton) {
+        if (!this->dirk_simplified_newton(x_old, t_old, h_old, K)) {
+          SANDALS_STATISTICS(this->m_statistics.newton_failures += 1;)
+          return false;
+        }
+      } else {
+        for (Integer n{0}; n < S; ++n) {
+          data.s = n;
+          K_ini = K.col(n);
+          if (this->m_newtonX.solve(
+              [this, &data](VectorN const & K_fun, VectorN & fun)
+                {
+                  data.K.col(data.s) = K_fun;
+                  this->dirk_function(data.s, data.x, data.t, data.h, data.K, fun);
+                },
+              [this, &data](VectorN const & K_jac, MatrixN & jac)
+                {
+                  SANDALS_STATISTICS(this->m_statistics.newton_iterations += 1;)
+                  SANDALS_STATISTICS(this->m_statistics.factorizations += 1;)
+                  data.K.col(data.s) = K_jac;
+                  this->dirk_jacobian(data.s, data.x, data.t, data.h, data.K, jac);
+                },
+              K_ini, K_sol)) {
             K.col(n) = K_sol;
           } else {
+            SANDALS_STATISTICS(this->m_statistics.newton_failures += 1;)
             return false;
           }
+        }
       }
 
       // Perform the step and obtain the next state
@@ -1198,6 +1470,347 @@ namespace Sandals {
       return true;
     }
 
+    /*\
+     |   ____  _                 _ _  __ _          _   _   _
+     |  / ___|(_)_ __ ___  _ __ | (_)/ _(_) ___  __| | | \ | | _____      _____ ___  _ __
+     |  \___ \| | '_ ` _ \| '_ \| | | |_| |/ _ \/ _` | |  \| |/ _ \ \ /\ / / __/ _ \| '_ \
+     |   ___) | | | | | | | |_) | | |  _| |  __/ (_| | | |\  |  __/\ V  V /| || (_) | | | |
+     |  |____/|_|_| |_| |_| .__/|_|_|_| |_|\___|\__,_| |_| \_|\___| \_/\_/ \__\___/|_| |_|
+     |                    |_|
+    \*/
+
+    /**
+    * Update the frozen Jacobians \f$ \mathbf{JF}_x \f$ and \f$ \mathbf{JF}_{x^\prime} \f$ of the
+    * simplified Newton method at the beginning of a step. The Jacobians are re-evaluated if they
+    * are not available, if the refresh is forced, or if the last simplified Newton solve contracted
+    * with a rate larger than \f$ \theta_{\max} \f$. The iteration matrix must be refactorized if the
+    * Jacobians are re-evaluated, or if the step changed with respect to the factorized one more
+    * than \f$ |h_k/h_{\text{fact}} - 1| > \rho \f$.
+    * \param[in] x States \f$ \mathbf{x} \f$.
+    * \param[in] x_dot States derivative \f$ \mathbf{x}^\prime \f$.
+    * \param[in] t Independent variable (or time) \f$ t \f$.
+    * \param[in] h Advancing step \f$ h \f$.
+    * \param[in] force If true, the Jacobians are re-evaluated anyway.
+    * \return True if the iteration matrix must be refactorized, false otherwise.
+    */
+    bool newton_update(VectorN const & x, VectorN const & x_dot, Real const t, Real const h,
+      bool const force) const
+    {
+      bool jacobian{force || !this->m_jacobian_available ||
+        this->m_newton_contraction > this->m_jacobian_contraction};
+      if (jacobian) {
+        SANDALS_STATISTICS(this->m_statistics.jacobian_x_evaluations += 1;)
+        SANDALS_STATISTICS(this->m_statistics.jacobian_x_dot_evaluations += 1;)
+        if (!this->m_reverse) {
+          this->m_JF_x     = this->m_system->JF_x(x, x_dot, t);
+          this->m_JF_x_dot = this->m_system->JF_x_dot(x, x_dot, t);
+        } else {
+          this->m_JF_x     = this->m_system->JF_x_reverse(x, x_dot, t);
+          this->m_JF_x_dot = this->m_system->JF_x_dot_reverse(x, x_dot, t);
+        }
+        this->m_jacobian_available = true;
+      }
+      this->m_jacobian_current   = jacobian;
+      this->m_newton_contraction = Real(0.0);
+      bool factorize{jacobian || this->m_newton_step == Real(0.0) ||
+        std::abs(h/this->m_newton_step - Real(1.0)) > this->m_refactorization_ratio};
+      if (factorize) {this->m_newton_step = h;}
+      return factorize;
+    }
+
+    /**
+    * Solve the nonlinear system \f$ \mathbf{G}(\mathbf{X}) = \mathbf{0} \f$ with the simplified
+    * Newton method, *i.e.*, with the iterations
+    *
+    * \f[
+    *   \mathbf{M} \Delta\mathbf{X}_k = \mathbf{G}(\mathbf{X}_k) \text{,} \quad
+    *   \mathbf{X}_{k+1} = \mathbf{X}_k - \Delta\mathbf{X}_k \text{,}
+    * \f]
+    *
+    * where the linear systems with the iteration matrix \f$ \mathbf{M} \f$ are solved by a given
+    * solver that reuses its (already computed) factorization. The contraction
+    * rate \f$ \theta_k = \|\Delta\mathbf{X}_k\| / \|\Delta\mathbf{X}_{k-1}\| \f$ is monitored, and
+    * the iterations are stopped when \f$ \|\Delta\mathbf{X}_k\| \leq \epsilon_{\text{newt}} \f$ or
+    * \f$ \theta_k/(1-\theta_k) \|\Delta\mathbf{X}_k\| \leq \epsilon_{\text{newt}} \f$, or aborted
+    * if the iterations diverge (\f$ \theta_k \geq 1 \f$).
+    * \tparam Vector The unknowns vector type.
+    * \tparam Function The residual function type.
+    * \tparam Solver The linear solver function type.
+    * \param[in] fun The residual function \f$ \mathbf{G}(\mathbf{X}) \f$.
+    * \param[in] solve The linear solver \f$ \Delta\mathbf{X} = \mathbf{M}^{-1}\mathbf{G} \f$.
+    * \param[in] scale The scaling of the unknowns' norm.
+    * \param[in,out] X The initial guess and the solution \f$ \mathbf{X} \f$.
+    * \return True if the iterations converged, false otherwise.
+    */
+    template <typename Vector, typename Function, typename Solver>
+    bool simplified_newton_solve(Function && fun, Solver && solve, Real const scale, Vector & X) const
+    {
+      Vector G, dX;
+      Real norm, norm_old{INFTY}, theta{0.0}, eta{1.0};
+      for (Integer k{0}; k < this->m_max_newton_iterations; ++k) {
+        fun(X, G);
+        if (!G.allFinite()) {return false;}
+        solve(G, dX);
+        X -= dX;
+        SANDALS_STATISTICS(this->m_statistics.newton_iterations += 1;)
+        norm = dX.template lpNorm<Eigen::Infinity>() / scale;
+        if (k > 0) {
+          theta = norm / norm_old;
+          this->m_newton_contraction = std::max(this->m_newton_contraction, theta);
+          if (theta >= Real(1.0)) {return false;}
+          eta = theta / (Real(1.0) - theta);
+        }
+        if (norm <= this->m_newton_tolerance || (k > 0 && eta * norm <= this->m_newton_tolerance)) {
+          return X.allFinite();
+        }
+        norm_old = norm;
+      }
+      this->m_newton_contraction = INFTY;
+      return false;
+    }
+
+    /**
+    * Factorize the iteration matrix of the simplified Newton method for IRK methods
+    *
+    * \f[
+    *   \mathbf{M} = \mathbf{I} \otimes \displaystyle\frac{1}{h}\mathbf{JF}_{x^\prime} +
+    *   \mathbf{A} \otimes \mathbf{JF}_x \text{,}
+    * \f]
+    *
+    * which is the Jacobian of the IRK residual when the Jacobians are frozen at the same point.
+    * If the matrix \f$ \mathbf{A} \f$ is diagonalizable, *i.e.*, \f$ \mathbf{A} = \mathbf{T}
+    * \mathbf{\Lambda} \mathbf{T}^{-1} \f$, the iteration matrix is transformed as
+    *
+    * \f[
+    *   \mathbf{M} = (\mathbf{T} \otimes \mathbf{I}) \left(\mathbf{I} \otimes \displaystyle\frac{1}{h}
+    *   \mathbf{JF}_{x^\prime} + \mathbf{\Lambda} \otimes \mathbf{JF}_x\right)
+    *   (\mathbf{T}^{-1} \otimes \mathbf{I}) \text{,}
+    * \f]
+    *
+    * so that the stage system decouples into one real \f$ N \times N \f$ system for each real
+    * eigenvalue \f$ \lambda \f$, with matrix \f$ \mathbf{JF}_{x^\prime}/h + \lambda \mathbf{JF}_x
+    * \f$, and one complex \f$ N \times N \f$ system for each complex conjugate pair \f$ \alpha \pm
+    * i\beta \f$, with matrix \f$ \mathbf{JF}_{x^\prime}/h + (\alpha - i\beta) \mathbf{JF}_x \f$.
+    * Otherwise, the full \f$ Ns \times Ns \f$ iteration matrix is factorized.
+    * \param[in] h Advancing step \f$ h \f$.
+    */
+    void irk_factorize(Real const h) const
+    {
+      using Eigen::seqN;
+      this->m_transformed = this->m_tableau.transform(this->m_T, this->m_T_inv, this->m_lambda);
+      if (this->m_transformed) {
+        for (Integer i{0}; i < S; ++i) {
+          SANDALS_STATISTICS(this->m_statistics.factorizations += 1;)
+          if constexpr (S > 1) {
+            if (this->m_lambda(i).imag() != 0.0) {
+              this->m_luC[i/2].compute(this->m_JF_x_dot.template cast<Complex>() / h +
+                this->m_lambda(i+1) * this->m_JF_x.template cast<Complex>());
+              ++i;
+              continue;
+            }
+          }
+          this->m_luX[i].compute(this->m_JF_x_dot / h + this->m_lambda(i).real() * this->m_JF_x);
+        }
+      } else {
+        MatrixJ jac;
+        for (Integer i{0}; i < S; ++i) {
+          for (Integer j{0}; j < S; ++j) {
+            jac(seqN(i*N, N), seqN(j*N, N)) = this->m_tableau.A(i,j) * this->m_JF_x;
+          }
+          jac(seqN(i*N, N), seqN(i*N, N)) += this->m_JF_x_dot / h;
+        }
+        this->m_luK.compute(jac);
+        SANDALS_STATISTICS(this->m_statistics.factorizations += 1;)
+      }
+    }
+
+    /**
+    * Solve the linear system \f$ \mathbf{M} \Delta\tilde{\mathbf{K}} = \mathbf{G} \f$ with the
+    * factorized iteration matrix of the simplified Newton method for IRK methods (see
+    * RungeKutta::irk_factorize).
+    * \param[in] G The right-hand side \f$ \mathbf{G} \f$.
+    * \param[out] dK The solution \f$ \Delta\tilde{\mathbf{K}} \f$.
+    */
+    void irk_solve(VectorK const & G, VectorK & dK) const
+    {
+      if (!this->m_transformed) {dK = this->m_luK.solve(G); return;}
+      MatrixK G_mat{G.reshaped(N, S) * this->m_T_inv.transpose()};
+      MatrixK W_mat;
+      [[maybe_unused]] VectorNC z;
+      for (Integer i{0}; i < S; ++i) {
+        if constexpr (S > 1) {
+          if (this->m_lambda(i).imag() != 0.0) {
+            z.real() = G_mat.col(i); z.imag() = G_mat.col(i+1);
+            z = this->m_luC[i/2].solve(z);
+            W_mat.col(i) = z.real(); W_mat.col(i+1) = z.imag();
+            ++i;
+            continue;
+          }
+        }
+        W_mat.col(i) = this->m_luX[i].solve(G_mat.col(i));
+      }
+      dK = (W_mat * this->m_T.transpose()).reshaped(N*S, 1);
+    }
+
+    /**
+    * Solve the stage equations of an IRK method with the simplified Newton method. The frozen
+    * Jacobians and the iteration matrix factorization are reused from the previous steps whenever
+    * possible. If the iterations fail with reused Jacobians, they are refreshed and the solve is
+    * attempted once more.
+    * \param[in] x_old States \f$ \mathbf{x}_k \f$ at the \f$ k \f$-th step.
+    * \param[in] t_old Independent variable (or time) \f$ t_k \f$ at the \f$ k \f$-th step.
+    * \param[in] h_old Advancing step \f$ h_k \f$ at the \f$ k \f$-th step.
+    * \param[in] K_ini The initial guess for the variables \f$ \tilde{\mathbf{K}} = h \mathbf{K} \f$.
+    * \param[out] K_sol The solution for the variables \f$ \tilde{\mathbf{K}} = h \mathbf{K} \f$.
+    * \return True if the stage equations are successfully solved, false otherwise.
+    */
+    bool irk_simplified_newton(VectorN const & x_old, Real const t_old, Real const h_old,
+      VectorK const & K_ini, VectorK & K_sol) const
+    {
+      Real scale{Real(1.0) + x_old.template lpNorm<Eigen::Infinity>()};
+      auto fun = [this, &x_old, t_old, h_old](VectorK const & K_fun, VectorK & G)
+        {this->irk_function(x_old, t_old, h_old, K_fun, G);};
+      auto solve = [this](VectorK const & G, VectorK & dK) {this->irk_solve(G, dK);};
+      for (bool force{false}; ; force = true) {
+        if (this->newton_update(x_old, K_ini.template head<N>()/h_old, t_old, h_old, force)) {
+          this->irk_factorize(h_old);
+        }
+        K_sol = K_ini;
+        if (this->simplified_newton_solve(fun, solve, scale, K_sol)) {return true;}
+        if (this->m_jacobian_current) {return false;}
+      }
+    }
+
+    /**
+    * Factorize the stage iteration matrices of the simplified Newton method for DIRK methods
+    *
+    * \f[
+    *   \mathbf{M}_n = a_{nn} \mathbf{JF}_x + \displaystyle\frac{1}{h}\mathbf{JF}_{x^\prime}
+    *   \text{,} \quad n = 1, 2, \ldots, s \text{.}
+    * \f]
+    *
+    * For SDIRK methods the iteration matrices of all the stages coincide, hence only the first one
+    * is factorized and shared across the stages.
+    * \param[in] h Advancing step \f$ h \f$.
+    */
+    void dirk_factorize(Real const h) const
+    {
+      Integer stages{this->is_sdirk() ? 1 : S};
+      for (Integer n{0}; n < stages; ++n) {
+        this->m_luX[n].compute(this->m_tableau.A(n,n) * this->m_JF_x + this->m_JF_x_dot / h);
+      }
+      SANDALS_STATISTICS(this->m_statistics.factorizations += stages;)
+    }
+
+    /**
+    * Solve the stage equations of a DIRK method, one stage after the other, with the simplified
+    * Newton method. The frozen Jacobians and the iteration matrix factorizations are reused from
+    * the previous steps whenever possible. If the iterations fail with reused Jacobians, they are
+    * refreshed and the solve is attempted once more.
+    * \param[in] x_old States \f$ \mathbf{x}_k \f$ at the \f$ k \f$-th step.
+    * \param[in] t_old Independent variable (or time) \f$ t_k \f$ at the \f$ k \f$-th step.
+    * \param[in] h_old Advancing step \f$ h_k \f$ at the \f$ k \f$-th step.
+    * \param[in,out] K The initial guess and the solution for the variables \f$ \tilde{\mathbf{K}}
+    * = h \mathbf{K} \f$.
+    * \return True if the stage equations are successfully solved, false otherwise.
+    */
+    bool dirk_simplified_newton(VectorN const & x_old, Real const t_old, Real const h_old,
+      MatrixK & K) const
+    {
+      Real scale{Real(1.0) + x_old.template lpNorm<Eigen::Infinity>()};
+      bool sdirk{this->is_sdirk()};
+      MatrixK K_ini(K);
+      VectorN K_sol;
+      for (bool force{false}; ; force = true) {
+        if (this->newton_update(x_old, K_ini.col(0)/h_old, t_old, h_old, force)) {
+          this->dirk_factorize(h_old);
+        }
+        K = K_ini;
+        bool converged{true};
+        for (Integer n{0}; converged && n < S; ++n) {
+          Eigen::PartialPivLU<MatrixN> const & lu{this->m_luX[sdirk ? 0 : n]};
+          auto solve = [&lu](VectorN const & G, VectorN & dK) {dK = lu.solve(G);};
+          auto fun = [this, n, &K, &x_old, t_old, h_old](VectorN const & K_fun, VectorN & G)
+            {K.col(n) = K_fun; this->dirk_function(n, x_old, t_old, h_old, K, G);};
+          K_sol = K.col(n);
+          converged = this->simplified_newton_solve(fun, solve, scale, K_sol);
+          K.col(n) = K_sol;
+        }
+        if (converged) {return true;}
+        if (this->m_jacobian_current) {return false;}
+      }
+    }
+
+    /**
+    * Store the variables \f$ \tilde{\mathbf{K}} = h \mathbf{K} \f$ of an accepted step, so that
+    * they can be used to predict the variables of the next step (see RungeKutta::predict).
+    * \param[in] t_old Independent variable (or time) \f$ t_k \f$ at the \f$ k \f$-th step.
+    * \param[in] h_old Advancing step \f$ h_k \f$ at the \f$ k \f$-th step.
+    * \param[in] K The variables \f$ \tilde{\mathbf{K}} \f$ of the accepted step.
+    */
+    void predictor_update(Real const t_old, Real const h_old, MatrixK const & K) const
+    {
+      if (!this->m_predictor) {return;}
+      this->m_predictor_K = K;
+      this->m_predictor_t = t_old + h_old;
+      this->m_predictor_h = h_old;
+    }
+
+    /**
+    * Predict the variables \f$ \tilde{\mathbf{K}} = h \mathbf{K} \f$ of the step from \f$ t_k \f$
+    * to \f$ t_k + h_k \f$, given the variables \f$ \tilde{\mathbf{K}}^{\text{old}} \f$ of the last
+    * accepted step of size \f$ h_{k-1} \f$ that ended at \f$ t_k \f$. If the nodes \f$ \mathbf{c}
+    * \f$ are distinct, the stage derivatives are interpolated by the polynomial (which, for
+    * collocation methods, is the derivative of the collocation polynomial)
+    *
+    * \f[
+    *   \mathbf{u}^\prime(\theta) = \displaystyle\sum_{j=1}^s \ell_j(\theta)
+    *   \frac{\tilde{\mathbf{K}}^{\text{old}}_j}{h_{k-1}} \text{,}
+    * \f]
+    *
+    * where \f$ \ell_j \f$ are the Lagrange polynomials on the nodes \f$ \mathbf{c} \f$. The
+    * polynomial is extrapolated to the nodes of the new step, *i.e.*, \f$ \tilde{\mathbf{K}}_i =
+    * h_k \mathbf{u}^\prime(1 + c_i h_k/h_{k-1}) \f$. Otherwise, the mean slope \f$
+    * \tilde{\mathbf{K}}^{\text{old}} \mathbf{b} / h_{k-1} \f$ of the last step is used for all
+    * the stages. If no accepted step ends at \f$ t_k \f$, the variables are set to zero.
+    * \param[in] t_old Independent variable (or time) \f$ t_k \f$ at the \f$ k \f$-th step.
+    * \param[in] h_old Advancing step \f$ h_k \f$ at the \f$ k \f$-th step.
+    * \param[out] K The predicted variables \f$ \tilde{\mathbf{K}} \f$.
+    * \return True if the variables are predicted, false if they are set to zero.
+    */
+    bool predict(Real const t_old, Real const h_old, MatrixK & K) const
+    {
+      if (!this->m_predictor || this->m_predictor_h == Real(0.0) ||
+        std::abs(t_old - this->m_predictor_t) > SQRT_EPSILON * (Real(1.0) + std::abs(t_old))) {
+        K.setZero();
+        return false;
+      }
+      Real ratio{h_old / this->m_predictor_h};
+      VectorS const & c{this->m_tableau.c};
+      bool distinct{true};
+      for (Integer j{0}; distinct && j < S; ++j) {
+        for (Integer m{0}; distinct && m < j; ++m) {distinct = std::abs(c(j) - c(m)) > SQRT_EPSILON;}
+      }
+      if (distinct) {
+        MatrixS L; // L(j,i) = l_j(1 + c_i h_k/h_{k-1})
+        for (Integer i{0}; i < S; ++i) {
+          Real theta{Real(1.0) + c(i) * ratio};
+          for (Integer j{0}; j < S; ++j) {
+            L(j,i) = Real(1.0);
+            for (Integer m{0}; m < S; ++m) {
+              if (m != j) {L(j,i) *= (theta - c(m)) / (c(j) - c(m));}
+            }
+          }
+        }
+        K.noalias() = ratio * this->m_predictor_K * L;
+      } else {
+        K.colwise() = ratio * this->m_predictor_K * this->m_tableau.b;
+      }
+      if (!K.allFinite()) {K.setZero(); return false;}
+      SANDALS_STATISTICS(this->m_statistics.predictions += 1;)
+      return true;
+    }
+
     /**
     * Compute a step using a generic integration method for a system of the form \f$ \mathbf{F}(
     * \mathbf{x}, \mathbf{x}^\prime, t) = \mathbf{0} \f$. The step is automatically selected
@@ -1215,6 +1828,8 @@ namespace Sandals {
     {
       #define CMD "Sandals::RungeKutta::step(...): "
 
+      SANDALS_TRACE_SCOPE(this->m_tracer, STEP);
+
       SANDALS_ASSERT(this->m_system->in_domain(x_old, t_old), CMD "in " << this->m_tableau.name <<
         " solver, at t = " << t_old << ", x = " << x_old.transpose() << ", system out of domain.");
 
@@ -1248,14 +1863,20 @@ namespace Sandals {
     {
       #define CMD "Sandals::RungeKutta::advance(...): "
 
+      SANDALS_TRACE_SCOPE(this->m_tracer, ADVANCE);
+
       // Check step size
       SANDALS_ASSERT(h_old > Real(0.0), CMD "in " << this->m_tableau.name << " solver, h = "<<
         h_old << ", expected > 0.");
 
       // If the integration step failed, try again with substepping
       MatrixK K;
-      if (!this->step(x_old, t_old, h_old, x_new, h_new, K))
-      {
+      if (this->step(x_old, t_old, h_old, x_new, h_new, K)) {
+        SANDALS_STATISTICS(this->m_statistics.accepted_steps += 1;)
+        this->predictor_update(t_old, h_old, K);
+      } else {
+        SANDALS_STATISTICS(this->m_statistics.rejected_steps += 1;)
+        SANDALS_STATISTICS(this->m_statistics.substeps += 1;)
         VectorN x_tmp(x_old);
         Real t_tmp{t_old}, h_tmp{h_old / Real(2.0)};
 
@@ -1267,6 +1888,8 @@ namespace Sandals {
           if (this->step(x_tmp, t_tmp, h_tmp, x_new, h_new_tmp, K)) {
 
             // Accept the step
+            SANDALS_STATISTICS(this->m_statistics.accepted_steps += 1;)
+            this->predictor_update(t_tmp, h_tmp, K);
             h_tmp = h_new_tmp;
 
             // If substepping is enabled, double the step size
@@ -1289,6 +1912,8 @@ namespace Sandals {
           } else {
 
             // If the substepping index is too high, abort the integration
+            SANDALS_STATISTICS(this->m_statistics.rejected_steps += 1;)
+            SANDALS_STATISTICS(this->m_statistics.substeps += 1;)
             k += 2;
             SANDALS_ASSERT(k < max_k, CMD "in " << this->m_tableau.name << " solver, at t = " <<
               t_tmp << ", integration failed with h = " << h_tmp << ", aborting.");
@@ -1339,6 +1964,12 @@ namespace Sandals {
     {
       using Eigen::last;
 
+      // Reset the work counters, timing histograms, frozen Jacobians, and stage predictor
+      this->m_statistics.reset();
+      this->m_tracer.reset();
+      this->reset_jacobian();
+      this->reset_predictor();
+
       // Instantiate output
       sol.resize(t_mesh.size());
 
@@ -1346,6 +1977,7 @@ namespace Sandals {
       sol.t(0)     = t_mesh(0);
       sol.x.col(0) = ics;
       sol.h.col(0) = this->m_system->h(ics, t_mesh(0));
+      SANDALS_STATISTICS(this->m_statistics.invariants_evaluations += 1;)
 
       // Callback on initial conditions
       if (this->m_step_callback) {this->m_step_callback(0, ics, t_mesh(0));}
@@ -1353,8 +1985,9 @@ namespace Sandals {
       // Update the current step
       Integer step{0};
       VectorN x_old_step(ics), x_new_step(ics);
-      Real t_step{t_mesh(0)}, h_step{t_mesh(1) - t_mesh(0)}, h_tmp_step{h_step}, h_new_step;
+      Real t_step{t_mesh(0)}, h_step{t_mesh(1) - t_mesh(0)}, h_tmp_step{h_step}, h_new_step{h_step};
       bool mesh_point_bool, saturation_bool;
+      bool adaptive_bool{this->m_adaptive && this->m_tableau.is_embedded};
 
       while (true) {
         // Integrate system
@@ -1364,9 +1997,9 @@ namespace Sandals {
         t_step += h_step;
 
         // Saturate the suggested timestep
-        mesh_point_bool = std::abs(t_step - t_mesh(step+1)) < SQRT_EPSILON;
+        mesh_point_bool = !adaptive_bool || std::abs(t_step - t_mesh(step+1)) < SQRT_EPSILON;
         saturation_bool = t_step + h_new_step > t_mesh(step+1) + SQRT_EPSILON;
-        if (this->m_adaptive && this->m_tableau.is_embedded && !mesh_point_bool && saturation_bool) {
+        if (adaptive_bool && !mesh_point_bool && saturation_bool) {
           h_tmp_step = h_new_step; // Used to store the previous step and keep the integration pace
           h_step     = t_mesh(step+1) - t_step;
         } else {
@@ -1374,22 +2007,29 @@ namespace Sandals {
         }
 
         // Store solution if the step is a mesh point
-        if (!this->m_adaptive || mesh_point_bool) {
+        if (mesh_point_bool) {
 
           // Update temporaries
           step += 1;
           h_step = h_tmp_step;
 
+          // Snap the time on the mesh if the step is not adapted (avoid round-off drift)
+          if (!adaptive_bool) {t_step = t_mesh(step);}
+
           // Update outputs
           sol.t(step)     = t_step;
           sol.x.col(step) = x_new_step;
           sol.h.col(step) = this->m_system->h(x_new_step, t_step);
+          SANDALS_STATISTICS(this->m_statistics.invariants_evaluations += 1;)
 
           // Callback after the step is completed
           if (this->m_step_callback) {this->m_step_callback(step, x_new_step, t_step);}
 
           // Check if the current step is the last one
-          if (std::abs(t_step - t_mesh(last)) < SQRT_EPSILON) {break;}
+          if (step == t_mesh.size()-1 || (adaptive_bool && std::abs(t_step - t_mesh(last)) < SQRT_EPSILON)) {break;}
+
+          // Follow the mesh spacing if the step is not adapted
+          if (!adaptive_bool) {h_step = t_mesh(step+1) - t_step;}
 
           // Update the previous step
           x_old_step = x_new_step;
@@ -1425,6 +2065,12 @@ namespace Sandals {
         return this->solve(t_mesh, ics, sol);
       }
 
+      // Reset the work counters, timing histograms, frozen Jacobians, and stage predictor
+      this->m_statistics.reset();
+      this->m_tracer.reset();
+      this->reset_jacobian();
+      this->reset_predictor();
+
       // Instantiate output
       Real t_step{t_mesh(0)}, h_step{t_mesh(1) - t_mesh(0)}, h_new_step, scale{100.0};
       Real h_min{std::max(this->m_min_step, h_step/scale)}, h_max{scale*h_step};
@@ -1439,6 +2085,7 @@ namespace Sandals {
       sol.t(0)     = t_mesh(0);
       sol.x.col(0) = ics;
       sol.h.col(0) = this->m_system->h(ics, t_mesh(0));
+      SANDALS_STATISTICS(this->m_statistics.invariants_evaluations += 1;)
 
       // Callback on initial conditions
       if (this->m_step_callback) {this->m_step_callback(0, ics, t_mesh(0));}
@@ -1468,6 +2115,7 @@ namespace Sandals {
         sol.t(step)     = t_step;
         sol.x.col(step) = x_new_step;
         sol.h.col(step) = this->m_system->h(x_new_step, t_step);
+        SANDALS_STATISTICS(this->m_statistics.invariants_evaluations += 1;)
 
         // Callback after the step is completed
         if (this->m_step_callback) {this->m_step_callback(step, x_new_step, t_step);}
@@ -1501,6 +2149,8 @@ namespace Sandals {
     {
       #define CMD "Sandals::RungeKutta::project(...): "
 
+      SANDALS_TRACE_SCOPE(this->m_tracer, PROJECT);
+
       // Check if there are any constraints
       x_projected = x;
       if (M > Integer(0)) {
@@ -1523,6 +2173,9 @@ namespace Sandals {
           // Evaluate the invariants vector and its Jacobian
           h    = this->m_system->h(x_projected, t);
           Jh_x = this->m_system->Jh_x(x_projected, t);
+          SANDALS_STATISTICS(this->m_statistics.invariants_evaluations += 1;)
+          SANDALS_STATISTICS(this->m_statistics.invariants_jacobian_evaluations += 1;)
+          SANDALS_STATISTICS(this->m_statistics.projection_iterations += 1;)
 
           // Check if the solution is found
           if (h.norm() < this->m_projection_tolerance) {return true;}
@@ -1535,6 +2188,7 @@ namespace Sandals {
 
           // Compute the solution of the linear system
           this->m_lu.compute(A);
+          SANDALS_STATISTICS(this->m_statistics.factorizations += 1;)
           SANDALS_ASSERT(this->m_lu.rank() == N+M, CMD "singular Jacobian detected.");
           x_step = this->m_lu.solve(b);
 
@@ -1595,6 +2249,9 @@ namespace Sandals {
           // Evaluate the invariants vector and its Jacobian
           h    = this->m_system->h(x_projected, t);
           Jh_x = this->m_system->Jh_x(x_projected, t);
+          SANDALS_STATISTICS(this->m_statistics.invariants_evaluations += 1;)
+          SANDALS_STATISTICS(this->m_statistics.invariants_jacobian_evaluations += 1;)
+          SANDALS_STATISTICS(this->m_statistics.projection_iterations += 1;)
 
           // Select only the projected invariants
           h    = h(projected_invariants);
@@ -1611,6 +2268,7 @@ namespace Sandals {
 
           // Compute the solution of the linear system
           lu.compute(A);
+          SANDALS_STATISTICS(this->m_statistics.factorizations += 1;)
           SANDALS_ASSERT(lu.rank() == X+H, CMD "singular Jacobian detected.");
           x_step = this->m_lu.solve(b);
 
@@ -1637,6 +2295,99 @@ namespace Sandals {
     * \return The estimated order of the method.
     */
     Real estimate_order(std::vector<VectorX> const & t_mesh, VectorN const & ics, std::function<MatrixX(VectorX)> & sol) const
+    {
+      this->check_order_meshes(t_mesh);
+
+      // Solve the system for each time scale
+      Integer meshes{static_cast<Integer>(t_mesh.size())};
+      VectorX h_vec(meshes), e_vec(meshes);
+      for (Integer i{0}; i < meshes; ++i) {
+        this->order_error(i, t_mesh[i], ics, sol, h_vec(i), e_vec(i));
+      }
+      return this->fit_order(h_vec, e_vec);
+    }
+
+    /**
+    * Estimate the order of the Runge-Kutta method by solving the system on the time meshes in
+    * parallel. The meshes are distributed on a pool of threads, and each thread owns a separate
+    * integrator with the same tableau, system and settings (except the step callback, which is not
+    * used), so that the Newton solvers and the work counters are never shared. The system and the
+    * analytical solution function are instead shared, and they must be safe to evaluate
+    * concurrently. The result is identical to the one of the serial estimate_order(...) method.
+    * \param[in] t_mesh The vector of time meshes with same initial and final time with *fixed* step.
+    * \param[in] ics Initial conditions \f$ \mathbf{x}(t = 0) \f$.
+    * \param[in] sol The *analytical* solution function.
+    * \param[in] threads The number of threads (if not positive, the hardware concurrency is used).
+    * \return The estimated order of the method.
+    */
+    Real estimate_order_parallel(std::vector<VectorX> const & t_mesh, VectorN const & ics,
+      std::function<MatrixX(VectorX)> & sol, Integer threads = 0) const
+    {
+      this->check_order_meshes(t_mesh);
+
+      // Set the pool size
+      Integer meshes{static_cast<Integer>(t_mesh.size())};
+      if (threads < Integer(1)) {threads = static_cast<Integer>(std::thread::hardware_concurrency());}
+      threads = std::max(Integer(1), std::min(threads, meshes));
+
+      // Solve the system for each time scale, the meshes are picked from a shared counter
+      VectorX h_vec(meshes), e_vec(meshes);
+      std::atomic<Integer> next{0};
+      std::vector<std::exception_ptr> errors(threads);
+      auto worker = [this, &t_mesh, &ics, &sol, &h_vec, &e_vec, &next, &errors, meshes](Integer const w) {
+        try {
+          RungeKutta rk(this->m_tableau, this->m_system);
+          rk.copy_settings(*this);
+          for (Integer i{next++}; i < meshes; i = next++) {
+            rk.order_error(i, t_mesh[i], ics, sol, h_vec(i), e_vec(i));
+          }
+        } catch (...) {
+          errors[w] = std::current_exception();
+        }
+      };
+      std::vector<std::thread> pool;
+      pool.reserve(threads);
+      for (Integer w{0}; w < threads; ++w) {pool.emplace_back(worker, w);}
+      for (std::thread & thread : pool) {thread.join();}
+      for (std::exception_ptr const & error : errors) {if (error) {std::rethrow_exception(error);}}
+      return this->fit_order(h_vec, e_vec);
+    }
+
+  private:
+    /**
+    * Copy the integration settings of another Runge-Kutta method, *i.e.*, tolerances, safety factors,
+    * step bounds, modes, and projection settings. The step callback is not copied.
+    * \param[in] t_rk The Runge-Kutta method to copy the settings from.
+    */
+    void copy_settings(RungeKutta const & t_rk)
+    {
+      this->m_absolute_tolerance        = t_rk.m_absolute_tolerance;
+      this->m_relative_tolerance        = t_rk.m_relative_tolerance;
+      this->m_safety_factor             = t_rk.m_safety_factor;
+      this->m_min_safety_factor         = t_rk.m_min_safety_factor;
+      this->m_max_safety_factor         = t_rk.m_max_safety_factor;
+      this->m_min_step                  = t_rk.m_min_step;
+      this->m_max_substeps              = t_rk.m_max_substeps;
+      this->m_adaptive                  = t_rk.m_adaptive;
+      this->m_reverse                   = t_rk.m_reverse;
+      this->m_projection_tolerance      = t_rk.m_projection_tolerance;
+      this->m_max_projection_iterations = t_rk.m_max_projection_iterations;
+      this->m_projection                = t_rk.m_projection;
+      this->m_newton_tolerance          = t_rk.m_newton_tolerance;
+      this->m_max_newton_iterations     = t_rk.m_max_newton_iterations;
+      this->m_jacobian_contraction      = t_rk.m_jacobian_contraction;
+      this->m_refactorization_ratio     = t_rk.m_refactorization_ratio;
+      this->m_simplified_newton         = t_rk.m_simplified_newton;
+      this->m_predictor                 = t_rk.m_predictor;
+      this->verbose_mode(t_rk.m_verbose);
+    }
+
+    /**
+    * Check that the time meshes used to estimate the order of the method have the same initial and
+    * final time, and a fixed step.
+    * \param[in] t_mesh The vector of time meshes.
+    */
+    void check_order_meshes(std::vector<VectorX> const & t_mesh) const
     {
       using Eigen::last;
 
@@ -1659,28 +2410,50 @@ namespace Sandals {
         }
       }
 
-      // Solve the system for each time scale
+      #undef CMD
+    }
+
+    /**
+    * Solve the system on a time mesh and compute the maximum absolute error with respect to the
+    * analytical solution.
+    * \param[in] i The index of the time mesh.
+    * \param[in] t_mesh The time mesh.
+    * \param[in] ics Initial conditions \f$ \mathbf{x}(t = 0) \f$.
+    * \param[in] sol The *analytical* solution function.
+    * \param[out] h The step of the time mesh.
+    * \param[out] e The maximum absolute error.
+    */
+    void order_error(Integer const i, VectorX const & t_mesh, VectorN const & ics,
+      std::function<MatrixX(VectorX)> & sol, Real & h, Real & e) const
+    {
+      #define CMD "Sandals::RungeKutta::estimate_order(...): "
+
       Solution<Real, N, M> sol_num;
-      MatrixX sol_ana;
-      VectorX h_vec(t_mesh.size()), e_vec(t_mesh.size());
-      for (Integer i{0}; i < static_cast<Integer>(t_mesh.size()); ++i) {
-        SANDALS_ASSERT(this->solve(t_mesh[i], ics, sol_num), CMD "failed to solve the system for " <<
-          "the" << i << "-th time mesh.");
-        sol_ana = sol(sol_num.t);
-        SANDALS_ASSERT(sol_ana.rows() == sol_num.x.rows(),
-          CMD "expected the same number of states in analytical solution.");
-        SANDALS_ASSERT(sol_ana.cols() == sol_num.x.cols(),
-          CMD "expected the same number of steps in analytical solution.");
-        h_vec(i) = std::abs(sol_num.t(1) - sol_num.t(0));
-        e_vec(i) = (sol_ana - sol_num.x).array().abs().maxCoeff();
-      }
+      SANDALS_ASSERT(this->solve(t_mesh, ics, sol_num), CMD "failed to solve the system for " <<
+        "the" << i << "-th time mesh.");
+      MatrixX sol_ana(sol(sol_num.t));
+      SANDALS_ASSERT(sol_ana.rows() == sol_num.x.rows(),
+        CMD "expected the same number of states in analytical solution.");
+      SANDALS_ASSERT(sol_ana.cols() == sol_num.x.cols(),
+        CMD "expected the same number of steps in analytical solution.");
+      h = std::abs(sol_num.t(1) - sol_num.t(0));
+      e = (sol_ana - sol_num.x).array().abs().maxCoeff();
+
+      #undef CMD
+    }
 
-      // Compute the order of the method thorugh least squares
+    /**
+    * Compute the order of the method through least squares on the logarithms of the steps and of
+    * the errors.
+    * \param[in] h_vec The steps of the time meshes.
+    * \param[in] e_vec The maximum absolute errors.
+    * \return The estimated order of the method.
+    */
+    Real fit_order(VectorX const & h_vec, VectorX const & e_vec) const
+    {
       VectorX A(h_vec.array().log());
       VectorX b(e_vec.array().log());
       return ((A.transpose() * A).ldlt().solve(A.transpose() * b))(0);
-
-      #undef CMD
     }
 
   }; // class RungeKutta
@@ -71,7 +71,7 @@ namespace Sandals {
     /**
     * Class constructor for the Solution class.
     */
-    Solution() : t(0), x(Vector::Zero(N, 0)), h(Vector::Zero(M, 0)) {}
+    Solution() : t(0), x(MatrixN::Zero(N, 0)), h(MatrixM::Zero(M, 0)) {}
 
     /**
     * Class constructor for the Solution class given the independent variable (or time) and states sizes.
@@ -0,0 +1,107 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#ifndef SANDALS_STATISTICS_HH
+#define SANDALS_STATISTICS_HH
+
+#include <Sandals.hh>
+
+namespace Sandals {
+
+  /*\
+   |   ____  _        _   _     _   _
+   |  / ___|| |_ __ _| |_(_)___| |_(_) ___ ___
+   |  \___ \| __/ _` | __| / __| __| |/ __/ __|
+   |   ___) | || (_| | |_| \__ \ |_| | (__\__ \
+   |  |____/ \__\__,_|\__|_|___/\__|_|\___|___/
+   |
+  \*/
+
+  /**
+  * \brief Struct container for the work counters of an integration.
+  *
+  * Struct container for the work counters of an integration, *i.e.*, the number of evaluations
+  * of the system functions and Jacobians, the number of Newton iterations and matrix factorizations,
+  * and the number of accepted, rejected, and substepped advancing steps. The counters are updated
+  * only if the preprocessor symbol \c SANDALS_ENABLE_STATISTICS is defined, otherwise all the
+  * updates are compiled out and the counters are left to zero.
+  */
+  struct Statistics
+  {
+    Integer function_evaluations{0};           /**< Number of evaluations of \f$ \mathbf{F} \f$ (or \f$ \mathbf{f} \f$). */
+    Integer jacobian_x_evaluations{0};         /**< Number of evaluations of \f$ \mathbf{JF}_x \f$. */
+    Integer jacobian_x_dot_evaluations{0};     /**< Number of evaluations of \f$ \mathbf{JF}_{x^\prime} \f$. */
+    Integer invariants_evaluations{0};         /**< Number of evaluations of \f$ \mathbf{h} \f$. */
+    Integer invariants_jacobian_evaluations{0}; /**< Number of evaluations of \f$ \mathbf{Jh}_x \f$. */
+    Integer newton_iterations{0};              /**< Number of Newton iterations. */
+    Integer newton_failures{0};                /**< Number of non-converged Newton solves. */
+    Integer predictions{0};                    /**< Number of Newton solves started from predicted stages. */
+    Integer factorizations{0};                 /**< Number of matrix factorizations. */
+    Integer accepted_steps{0};                 /**< Number of accepted steps. */
+    Integer rejected_steps{0};                 /**< Number of rejected (or failed) steps. */
+    Integer substeps{0};                       /**< Number of added substepping layers. */
+    Integer projection_iterations{0};          /**< Number of projection iterations. */
+
+    /**
+    * Reset all the counters to zero.
+    */
+    void reset() {*this = Statistics();}
+
+    /**
+    * Check if the counters are updated, *i.e.*, if the statistics are enabled at compile time.
+    * \return True if the statistics are enabled, false otherwise.
+    */
+    static constexpr bool enabled()
+    {
+      #ifdef SANDALS_ENABLE_STATISTICS
+      return true;
+      #else
+      return false;
+      #endif
+    }
+
+    /**
+    * Print the statistics information to the output stream.
+    * \return The statistics information as a string.
+    */
+    std::string info() const
+    {
+      std::ostringstream os;
+      os
+        << "Statistics:" << (enabled() ? "" : "\t(disabled)") << std::endl
+        << "\t- F evaluations:\t" << this->function_evaluations << std::endl
+        << "\t- JF_x evaluations:\t" << this->jacobian_x_evaluations << std::endl
+        << "\t- JF_x_dot evaluations:\t" << this->jacobian_x_dot_evaluations << std::endl
+        << "\t- h evaluations:\t" << this->invariants_evaluations << std::endl
+        << "\t- Jh_x evaluations:\t" << this->invariants_jacobian_evaluations << std::endl
+        << "\t- Newton iterations:\t" << this->newton_iterations << std::endl
+        << "\t- Newton failures:\t" << this->newton_failures << std::endl
+        << "\t- predictions:\t" << this->predictions << std::endl
+        << "\t- factorizations:\t" << this->factorizations << std::endl
+        << "\t- accepted steps:\t" << this->accepted_steps << std::endl
+        << "\t- rejected steps:\t" << this->rejected_steps << std::endl
+        << "\t- substeps:\t" << this->substeps << std::endl
+        << "\t- projection iterations:\t" << this->projection_iterations << std::endl;
+      return os.str();
+    }
+
+    /**
+    * Print the statistics information on a stream.
+    * \param[in,out] os Output stream.
+    */
+    void info(std::ostream &os) const {os << this->info();}
+
+  }; // struct Statistics
+
+} // namespace Sandals
+
+#endif // SANDALS_STATISTICS_HH
@@ -48,10 +48,6 @@ namespace Sandals {
     using VectorB = typename Explicit<Real, N, M>::VectorF; /**< Templetized vector type. */
     using Type = typename Explicit<Real, N, M>::Type; /**< System type enumeration. */
 
-  private:
-    Eigen::FullPivLU<MatrixE> m_lu; /**< LU decomposition. */
-
-  public:
     /**
     * Class constructor for the linear ODE/DAE system.
     */
@@ -128,9 +124,9 @@ namespace Sandals {
     */
     VectorF f(VectorF const & x, Real const t) const override
     {
-      this->m_lu.compute(this->E(t));
-      SANDALS_ASSERT(this->m_lu.rank() == N, "Sandals:Linear::f(...): singular mass matrix E(t) detected.");
-      return this->m_lu.solve(this->A(t)*x + this->b(t));
+      Eigen::FullPivLU<MatrixE> lu(this->E(t));
+      SANDALS_ASSERT(lu.rank() == N, "Sandals:Linear::f(...): singular mass matrix E(t) detected.");
+      return lu.solve(this->A(t)*x + this->b(t));
     }
 
     /**
@@ -148,9 +144,9 @@ namespace Sandals {
     */
     MatrixJF Jf_x(VectorF const & /*x*/, Real const t) const override
     {
-      this->m_lu.compute(this->E(t));
-      SANDALS_ASSERT(this->m_lu.rank() == N, "Sandals:Linear::Jf_x(...): singular mass matrix E(t) detected.");
-      return this->m_lu.solve(this->A(t));
+      Eigen::FullPivLU<MatrixE> lu(this->E(t));
+      SANDALS_ASSERT(lu.rank() == N, "Sandals:Linear::Jf_x(...): singular mass matrix E(t) detected.");
+      return lu.solve(this->A(t));
     }
 
     /**
@@ -46,15 +46,11 @@ namespace Sandals {
     using VectorF = typename Explicit<Real, N, M>::VectorF; /**< Templetized vector type. */
     using MatrixJF = typename Explicit<Real, N, M>::MatrixJF; /**< Templetized matrix type. */
     using MatrixA = typename Explicit<Real, N, M>::MatrixJF; /**< Templetized matrix type. */
-    using TensorTA = typename std::vector<MatrixJF>; /**< Templetized matrix type. */
+    using TensorTA = typename std::array<MatrixJF, N>; /**< Templetized tensor type (fixed-size, no heap allocation). */
     using VectorB = typename Explicit<Real, N, M>::VectorF; /**< Templetized vector type. */
     using MatrixJB = typename Explicit<Real, N, M>::MatrixJF; /**< Templetized vector type. */
     using Type = typename Explicit<Real, N, M>::Type; /**< System type enumeration. */
 
-  private:
-    mutable Eigen::FullPivLU<MatrixA> m_lu; /**< LU decomposition. */
-
-  public:
     /**
     * Class constructor for the semi-explicit ODE/DAE system.
     */
@@ -139,10 +135,10 @@ namespace Sandals {
     */
     VectorF f(VectorF const & x, Real const t) const override
     {
-      this->m_lu.compute(this->A(x, t));
-      SANDALS_ASSERT(this->m_lu.rank() == N,
+      Eigen::FullPivLU<MatrixA> lu(this->A(x, t));
+      SANDALS_ASSERT(lu.rank() == N,
         "Sandals:SemiExplicit::f(...): singular mass matrix A detected.");
-      return this->m_lu.solve(this->b(x, t));
+      return lu.solve(this->b(x, t));
     }
 
     /**
@@ -164,11 +160,11 @@ namespace Sandals {
     {
       TensorTA TA_x{this->TA_x(x, t)};
       MatrixJF tAp{MatrixJF::Zero()};
-      for (Integer i{0}; i < N; ++i) {tAp.col(i) = TA_x[i] * x_dot;} // TODO: Check if TA_x.size() = N
-      this->m_lu.compute(this->A(x, t));
-      SANDALS_ASSERT(this->m_lu.rank() == N,
+      for (Integer i{0}; i < N; ++i) {tAp.col(i) = TA_x[i] * x_dot;}
+      Eigen::FullPivLU<MatrixA> lu(this->A(x, t));
+      SANDALS_ASSERT(lu.rank() == N,
         "Sandals:SemiExplicit::Jf_x(...): singular mass matrix A detected.");
-      return this->m_lu.solve(this->Jb_x(x, t) - tAp);
+      return lu.solve(this->Jb_x(x, t) - tAp);
     }
 
     /**
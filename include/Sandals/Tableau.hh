@@ -42,6 +42,7 @@ namespace Sandals {
     using Type = enum class type : Integer {ERK = 0, IRK = 1, DIRK = 2}; /**< Runge-Kutta type enumeration. */
     using Vector = Eigen::Vector<Real, S>;    /**< Templetized vector type. */
     using Matrix = Eigen::Matrix<Real, S, S>; /**< Templetized matrix type. */
+    using VectorC = Eigen::Vector<std::complex<Real>, S>; /**< Templetized complex vector type. */
 
     std::string name;                /**< Name of the Runge-Kutta method. */
     Type        type;                /**< Runge-Kutta type. */
@@ -53,6 +54,72 @@ namespace Sandals {
     Vector      c;                   /**< Nodes vector \f$ \mathbf{c} \f$. */
     bool        is_embedded{false};  /**< Embedded method boolean. */
 
+    /**
+    * Check if the Butcher tableau is of a singly diagonally implicit Runge-Kutta (SDIRK) method,
+    * *i.e.*, of a DIRK method with a constant non-zero diagonal \f$ a_{ii} = \gamma \f$.
+    * \return True if the Butcher tableau is of an SDIRK method, false otherwise.
+    */
+    bool is_sdirk() const
+    {
+      return this->type == Type::DIRK && this->A(0,0) != 0.0 &&
+        this->A.diagonal().isConstant(this->A(0,0));
+    }
+
+    /**
+    * Compute the real block-diagonal (eigenvalue) form of the matrix \f$ \mathbf{A} \f$, *i.e.*,
+    * \f$ \mathbf{A} = \mathbf{T} \mathbf{\Lambda} \mathbf{T}^{-1} \f$, where each complex conjugate
+    * pair of eigenvalues \f$ \alpha \pm i\beta \f$ yields the \f$ 2 \times 2 \f$ block
+    *
+    * \f[
+    *   \begin{bmatrix} \alpha & \beta \\ -\beta & \alpha \end{bmatrix} \text{,}
+    * \f]
+    *
+    * and the corresponding columns of \f$ \mathbf{T} \f$ are the real and imaginary parts of the
+    * eigenvector of \f$ \alpha + i\beta \f$. The complex pairs come first (as consecutive entries
+    * \f$ \alpha + i\beta \f$ and \f$ \alpha - i\beta \f$), followed by the real eigenvalues.
+    * \param[out] T The transformation matrix \f$ \mathbf{T} \f$.
+    * \param[out] T_inv The inverse transformation matrix \f$ \mathbf{T}^{-1} \f$.
+    * \param[out] lambda The eigenvalues of \f$ \mathbf{A} \f$.
+    * \return True if \f$ \mathbf{A} \f$ is (numerically) diagonalizable, false otherwise.
+    */
+    bool transform(Matrix & T, Matrix & T_inv, VectorC & lambda) const
+    {
+      Eigen::EigenSolver<Matrix> eig(this->A);
+      if (eig.info() != Eigen::Success) {return false;}
+      VectorC values{eig.eigenvalues()};
+      typename Eigen::EigenSolver<Matrix>::EigenvectorsType vectors{eig.eigenvectors()};
+
+      // Complex conjugate pairs first, then real eigenvalues
+      Matrix Lambda{Matrix::Zero()};
+      Integer k{0};
+      if constexpr (S > 1) {
+        for (Integer i{0}; i < S; ++i) {
+          if (values(i).imag() > this->SQRT_EPSILON) {
+            Real alpha{values(i).real()}, beta{values(i).imag()};
+            T.col(k) = vectors.col(i).real(); T.col(k+1) = vectors.col(i).imag();
+            lambda(k) = std::complex<Real>(alpha, beta); lambda(k+1) = std::conj(lambda(k));
+            Lambda(k, k) = alpha; Lambda(k, k+1) = beta; Lambda(k+1, k) = -beta; Lambda(k+1, k+1) = alpha;
+            k += 2;
+          }
+        }
+      }
+      for (Integer i{0}; i < S; ++i) {
+        if (std::abs(values(i).imag()) <= this->SQRT_EPSILON) {
+          T.col(k) = vectors.col(i).real();
+          lambda(k) = std::complex<Real>(values(i).real(), 0.0);
+          Lambda(k, k) = values(i).real();
+          k += 1;
+        }
+      }
+      if (k != S) {return false;}
+
+      // Check that the eigenvectors are independent
+      Eigen::PartialPivLU<Matrix> lu(T);
+      if (!(lu.rcond() > this->SQRT_EPSILON)) {return false;}
+      T_inv = lu.inverse();
+      return (T * Lambda * T_inv - this->A).norm() <= this->SQRT_EPSILON * (1.0 + this->A.norm());
+    }
+
     /**
     * Check the Butcher tableau consistency for a generic Runge-Kutta method.
     * \param[in] verbose Verbosity flag.
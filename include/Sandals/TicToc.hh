@@ -13,6 +13,8 @@
 #ifndef SANDALS_TIC_TOC_HH
 #define SANDALS_TIC_TOC_HH
 
+#include <algorithm>
+
 #include <Sandals.hh>
 
 namespace Sandals {
@@ -29,18 +31,24 @@ namespace Sandals {
   /**
   * \brief Class container for a timer.
   *
-  * Class container for a timer that uses the C++ standard library chrono to measure the elapsed time
-  * between two points in the code.
+  * Class container for a timer that uses the C++ standard library monotonic clock to measure the
+  * elapsed time between two points in the code with nanosecond resolution. Every tic-toc interval
+  * is also stored as a lap, so that the timer can be used for repeated-run benchmarking. The first
+  * laps can be discarded as warm-up iterations, and the statistics of the remaining laps (minimum,
+  * mean, median, standard deviation, and percentiles) are available in milliseconds.
   */
   template <typename Real>
   class TicToc {
 
-    using Clock = std::chrono::high_resolution_clock; /**< Clock type. */
-    using Time  = std::chrono::microseconds;          /**< Time type. */
+    using Clock = std::chrono::steady_clock; /**< Clock type. */
+    using Time  = std::chrono::nanoseconds;  /**< Time type. */
 
     Clock::time_point m_start_time;   /**< Start time. */
     Clock::time_point m_stop_time;    /**< Stop time. */
     Time              m_elapsed_time; /**< Elapsed time. */
+    Integer           m_warm_up{0};   /**< Number of warm-up laps to be discarded. */
+    Integer           m_skipped{0};   /**< Number of warm-up laps already discarded. */
+    std::vector<Real> m_laps;         /**< Recorded laps (ms). */
 
   public:
     /**
@@ -58,13 +66,19 @@ namespace Sandals {
     */
     TicToc() : m_elapsed_time(0) {}
 
+    /**
+    * Class constructor for the timer.
+    * \param[in] t_warm_up The number of warm-up laps to be discarded.
+    */
+    TicToc(Integer const t_warm_up) : m_elapsed_time(0), m_warm_up(t_warm_up) {}
+
     /**
     * Start the timer.
     */
     void tic() {this->m_start_time = Clock::now();}
 
     /**
-    * Stop the timer.
+    * Stop the timer and record the lap, unless it is a warm-up lap.
     */
     void toc()
     {
@@ -72,25 +86,156 @@ namespace Sandals {
       this->m_elapsed_time = std::chrono::duration_cast<Time>(
         this->m_stop_time - this->m_start_time
       );
+      if (this->m_skipped < this->m_warm_up) {++this->m_skipped;}
+      else {this->m_laps.push_back(this->elapsed_ms());}
+    }
+
+    /**
+    * Time a function over a number of repetitions, after the warm-up laps.
+    * \param[in] function The function to be timed.
+    * \param[in] repetitions The number of recorded laps.
+    */
+    template <typename Function>
+    void run(Function && function, Integer const repetitions)
+    {
+      this->m_laps.reserve(this->m_laps.size() + repetitions);
+      for (Integer i{this->m_skipped}; i < this->m_warm_up; ++i) {this->tic(); function(); this->toc();}
+      for (Integer i{0}; i < repetitions; ++i) {this->tic(); function(); this->toc();}
+    }
+
+    /**
+    * Discard all the recorded laps and restart the warm-up.
+    */
+    void reset()
+    {
+      this->m_elapsed_time = Time(0);
+      this->m_skipped      = 0;
+      this->m_laps.clear();
     }
 
     /**
-    * Get the elapsed time in seconds.
+    * Get the number of warm-up laps.
+    * \return The number of warm-up laps.
+    */
+    Integer warm_up() const {return this->m_warm_up;}
+
+    /**
+    * Set the number of warm-up laps.
+    * \param[in] t_warm_up The number of warm-up laps to be discarded.
+    */
+    void warm_up(Integer const t_warm_up) {this->m_warm_up = t_warm_up;}
+
+    /**
+    * Get the elapsed time of the last lap in seconds.
     * \return The elapsed time in seconds.
     */
-    Real elapsed_s() const {return Real(1.0e-6)*this->m_elapsed_time.count();}
+    Real elapsed_s() const {return Real(1.0e-9)*this->m_elapsed_time.count();}
 
     /**
-    * Get the elapsed time in milliseconds.
+    * Get the elapsed time of the last lap in milliseconds.
     * \return The elapsed time in milliseconds.
     */
-    Real elapsed_ms() const {return Real(1.0e-3)*this->m_elapsed_time.count();}
+    Real elapsed_ms() const {return Real(1.0e-6)*this->m_elapsed_time.count();}
 
     /**
-    * Get the elapsed time in microseconds.
+    * Get the elapsed time of the last lap in microseconds.
     * \return The elapsed time in microseconds.
     */
-    Real elapsed_us() const {return this->m_elapsed_time.count();}
+    Real elapsed_us() const {return Real(1.0e-3)*this->m_elapsed_time.count();}
+
+    /**
+    * Get the elapsed time of the last lap in nanoseconds.
+    * \return The elapsed time in nanoseconds.
+    */
+    Real elapsed_ns() const {return this->m_elapsed_time.count();}
+
+    /**
+    * Get the number of recorded laps.
+    * \return The number of recorded laps.
+    */
+    Integer laps() const {return static_cast<Integer>(this->m_laps.size());}
+
+    /**
+    * Get the recorded laps in milliseconds.
+    * \return The recorded laps in milliseconds.
+    */
+    std::vector<Real> const & laps_ms() const {return this->m_laps;}
+
+    /**
+    * Get the total time of the recorded laps in milliseconds.
+    * \return The total time in milliseconds.
+    */
+    Real total_ms() const
+    {
+      Real total{0.0};
+      for (Real const lap : this->m_laps) {total += lap;}
+      return total;
+    }
+
+    /**
+    * Get the minimum time of the recorded laps in milliseconds.
+    * \return The minimum time in milliseconds, or NaN if no lap is recorded.
+    */
+    Real min_ms() const
+    {
+      if (this->m_laps.empty()) {return std::numeric_limits<Real>::quiet_NaN();}
+      return *std::min_element(this->m_laps.begin(), this->m_laps.end());
+    }
+
+    /**
+    * Get the maximum time of the recorded laps in milliseconds.
+    * \return The maximum time in milliseconds, or NaN if no lap is recorded.
+    */
+    Real max_ms() const
+    {
+      if (this->m_laps.empty()) {return std::numeric_limits<Real>::quiet_NaN();}
+      return *std::max_element(this->m_laps.begin(), this->m_laps.end());
+    }
+
+    /**
+    * Get the mean time of the recorded laps in milliseconds.
+    * \return The mean time in milliseconds, or NaN if no lap is recorded.
+    */
+    Real mean_ms() const
+    {
+      if (this->m_laps.empty()) {return std::numeric_limits<Real>::quiet_NaN();}
+      return this->total_ms() / this->m_laps.size();
+    }
+
+    /**
+    * Get the sample standard deviation of the recorded laps in milliseconds.
+    * \return The standard deviation in milliseconds, or NaN if less than two laps are recorded.
+    */
+    Real stddev_ms() const
+    {
+      if (this->m_laps.size() < 2) {return std::numeric_limits<Real>::quiet_NaN();}
+      Real mean{this->mean_ms()}, sum{0.0};
+      for (Real const lap : this->m_laps) {sum += (lap - mean)*(lap - mean);}
+      return std::sqrt(sum / (this->m_laps.size() - 1));
+    }
+
+    /**
+    * Get a percentile of the recorded laps in milliseconds, linearly interpolated between the
+    * closest ranks.
+    * \param[in] p The percentile in \f$ [0, 100] \f$.
+    * \return The percentile in milliseconds, or NaN if no lap is recorded.
+    */
+    Real percentile_ms(Real const p) const
+    {
+      if (this->m_laps.empty()) {return std::numeric_limits<Real>::quiet_NaN();}
+      std::vector<Real> sorted(this->m_laps);
+      std::sort(sorted.begin(), sorted.end());
+      Real rank{std::min(std::max(p, Real(0.0)), Real(100.0)) / Real(100.0) * (sorted.size() - 1)};
+      std::size_t i{static_cast<std::size_t>(std::floor(rank))};
+      std::size_t j{std::min(i + 1, sorted.size() - 1)};
+      return sorted[i] + (rank - i) * (sorted[j] - sorted[i]);
+    }
+
+    /**
+    * Get the median time of the recorded laps in milliseconds.
+    * \return The median time in milliseconds, or NaN if no lap is recorded.
+    */
+    Real median_ms() const {return this->percentile_ms(50.0);}
 
   }; // class TicToc
 
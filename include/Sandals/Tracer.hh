@@ -0,0 +1,251 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#pragma once
+
+#ifndef SANDALS_TRACER_HH
+#define SANDALS_TRACER_HH
+
+#include <array>
+#include <cstdint>
+#include <iomanip>
+
+#include <Sandals.hh>
+
+namespace Sandals {
+
+  /*\
+   |   _____
+   |  |_   _| __ __ _  ___ ___ _ __
+   |    | || '__/ _` |/ __/ _ \ '__|
+   |    | || | | (_| | (_|  __/ |
+   |    |_||_|  \__,_|\___\___|_|
+   |
+  \*/
+
+  /**
+  * \brief Class container for the per-phase timing histograms of an integration.
+  *
+  * Class container for the per-phase timing histograms of an integration. Each phase of the
+  * integration (*e.g.*, the advancing step or the projection) collects the number of calls, the
+  * total elapsed time, and a histogram of the elapsed times with logarithmic (base 2) buckets in
+  * nanoseconds, from which the percentiles are estimated. The timings are collected only if the
+  * preprocessor symbol \c SANDALS_ENABLE_TRACING is defined, otherwise all the tracing scopes are
+  * compiled out and the histograms are left empty.
+  */
+  class Tracer
+  {
+  public:
+    using Clock = std::chrono::steady_clock; /**< Monotonic clock type. */
+
+    /**
+    * \brief Enumeration class for the traced phases.
+    */
+    enum class Phase {
+      STEP = 0,          /**< Generic step dispatch. */
+      ERK_EXPLICIT_STEP, /**< Explicit Runge-Kutta step on an explicit system. */
+      ERK_IMPLICIT_STEP, /**< Explicit Runge-Kutta step on an implicit system. */
+      IRK_STEP,          /**< Implicit Runge-Kutta step. */
+      DIRK_STEP,         /**< Diagonally implicit Runge-Kutta step. */
+      ADVANCE,           /**< Advancing step (with substepping and projection). */
+      PROJECT            /**< Projection on the invariants manifold. */
+    };
+
+    static constexpr Integer PHASES{7};   /**< Number of traced phases. */
+    static constexpr Integer BUCKETS{64}; /**< Number of logarithmic histogram buckets. */
+
+    /**
+    * \brief Struct container for the timing histogram of a phase.
+    */
+    struct Histogram
+    {
+      std::uint64_t count{0};                        /**< Number of calls. */
+      std::uint64_t total{0};                        /**< Total elapsed time (ns). */
+      std::uint64_t min{UINT64_MAX};                 /**< Minimum elapsed time (ns). */
+      std::uint64_t max{0};                          /**< Maximum elapsed time (ns). */
+      std::array<std::uint64_t, BUCKETS> buckets{};  /**< Bucket \f$ b \f$ holds times in \f$ [2^b, 2^{b+1}) \f$ ns. */
+
+      /**
+      * Add a sample to the histogram.
+      * \param[in] ns The elapsed time in nanoseconds.
+      */
+      void add(std::uint64_t const ns)
+      {
+        Integer b{0};
+        for (std::uint64_t v{ns}; v > 1 && b < BUCKETS-1; v >>= 1) {++b;}
+        ++this->buckets[b];
+        ++this->count;
+        this->total += ns;
+        this->min = std::min(this->min, ns);
+        this->max = std::max(this->max, ns);
+      }
+
+      /**
+      * Get the mean elapsed time.
+      * \return The mean elapsed time in nanoseconds.
+      */
+      double mean() const {return this->count > 0 ? double(this->total)/double(this->count) : 0.0;}
+
+      /**
+      * Estimate a percentile of the elapsed times by linear interpolation inside the bucket that
+      * contains it. The estimate is clamped to the measured minimum and maximum.
+      * \param[in] p The percentile in \f$ [0, 100] \f$.
+      * \return The estimated percentile in nanoseconds.
+      */
+      double percentile(double const p) const
+      {
+        if (this->count == 0) {return 0.0;}
+        double rank{std::min(std::max(p, 0.0), 100.0) / 100.0 * double(this->count)};
+        double cumulated{0.0};
+        for (Integer b{0}; b < BUCKETS; ++b) {
+          if (this->buckets[b] == 0) {continue;}
+          if (cumulated + double(this->buckets[b]) >= rank) {
+            double lower{b > 0 ? std::ldexp(1.0, b) : 0.0}, upper{std::ldexp(1.0, b+1)};
+            double value{lower + (upper - lower) * (rank - cumulated) / double(this->buckets[b])};
+            return std::min(std::max(value, double(this->min)), double(this->max));
+          }
+          cumulated += double(this->buckets[b]);
+        }
+        return double(this->max);
+      }
+    };
+
+  private:
+    std::array<Histogram, PHASES> m_histograms{}; /**< Histograms of the traced phases. */
+
+  public:
+    /**
+    * Check if the tracing scopes are active, *i.e.*, if the tracing is enabled at compile time.
+    * \return True if the tracing is enabled, false otherwise.
+    */
+    static constexpr bool enabled()
+    {
+      #ifdef SANDALS_ENABLE_TRACING
+      return true;
+      #else
+      return false;
+      #endif
+    }
+
+    /**
+    * Get the name of a phase.
+    * \param[in] phase The phase.
+    * \return The name of the phase.
+    */
+    static std::string name(Phase const phase)
+    {
+      switch (phase) {
+        case Phase::STEP:              return "step";
+        case Phase::ERK_EXPLICIT_STEP: return "erk_explicit_step";
+        case Phase::ERK_IMPLICIT_STEP: return "erk_implicit_step";
+        case Phase::IRK_STEP:          return "irk_step";
+        case Phase::DIRK_STEP:         return "dirk_step";
+        case Phase::ADVANCE:           return "advance";
+        case Phase::PROJECT:           return "project";
+      }
+      return "unknown";
+    }
+
+    /**
+    * Record the elapsed time of a phase.
+    * \param[in] phase The phase.
+    * \param[in] ns The elapsed time in nanoseconds.
+    */
+    void record(Phase const phase, std::uint64_t const ns)
+      {this->m_histograms[static_cast<Integer>(phase)].add(ns);}
+
+    /**
+    * Get the histogram of a phase.
+    * \param[in] phase The phase.
+    * \return The histogram of the phase.
+    */
+    Histogram const & histogram(Phase const phase) const
+      {return this->m_histograms[static_cast<Integer>(phase)];}
+
+    /**
+    * Reset all the histograms.
+    */
+    void reset() {this->m_histograms.fill(Histogram());}
+
+    /**
+    * Print the tracing information to the output stream.
+    * \return The tracing information as a string.
+    */
+    std::string info() const
+    {
+      std::ostringstream os;
+      os << "Tracer:" << (enabled() ? "" : "\t(disabled)") << std::endl
+        << std::setw(20) << "phase" << std::setw(12) << "count" << std::setw(16) << "total [ns]"
+        << std::setw(14) << "p50 [ns]" << std::setw(14) << "p99 [ns]" << std::endl;
+      for (Integer i{0}; i < PHASES; ++i) {
+        Histogram const & hist{this->m_histograms[i]};
+        if (hist.count == 0) {continue;}
+        os << std::setw(20) << name(static_cast<Phase>(i)) << std::setw(12) << hist.count
+          << std::setw(16) << hist.total << std::setw(14) << std::llround(hist.percentile(50.0))
+          << std::setw(14) << std::llround(hist.percentile(99.0)) << std::endl;
+      }
+      return os.str();
+    }
+
+    /**
+    * Print the tracing information on a stream.
+    * \param[in,out] os Output stream.
+    */
+    void info(std::ostream &os) const {os << this->info();}
+
+  }; // class Tracer
+
+  /**
+  * \brief Class container for a tracing scope.
+  *
+  * Class container for a tracing scope, which measures the elapsed time between its construction
+  * and its destruction with a monotonic clock and records it in the histogram of a phase. Use it
+  * through the \c SANDALS_TRACE_SCOPE macro, so that it is compiled out when the tracing is disabled.
+  */
+  class TraceScope
+  {
+    Tracer            & m_tracer; /**< Tracer reference. */
+    Tracer::Phase       m_phase;  /**< Traced phase. */
+    Tracer::Clock::time_point m_start; /**< Start time. */
+
+  public:
+    /**
+    * Copy constructor for the tracing scope.
+    */
+    TraceScope(TraceScope const &) = delete;
+
+    /**
+    * Assignment operator for the tracing scope.
+    */
+    TraceScope & operator=(TraceScope const &) = delete;
+
+    /**
+    * Class constructor for the tracing scope, which starts the timer.
+    * \param[in] t_tracer The tracer reference.
+    * \param[in] t_phase The traced phase.
+    */
+    TraceScope(Tracer & t_tracer, Tracer::Phase const t_phase)
+      : m_tracer(t_tracer), m_phase(t_phase), m_start(Tracer::Clock::now()) {}
+
+    /**
+    * Class destructor for the tracing scope, which stops the timer and records the elapsed time.
+    */
+    ~TraceScope()
+    {
+      this->m_tracer.record(this->m_phase, static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Tracer::Clock::now() - this->m_start).count()
+      ));
+    }
+
+  }; // class TraceScope
+
+} // namespace Sandals
+
+#endif // SANDALS_TRACER_HH
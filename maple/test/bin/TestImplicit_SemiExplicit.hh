@@ -90,7 +90,7 @@ public:
     // Nothing to evaluate
 
     // Return results
-    TensorTA out_TA_x(2);
+    TensorTA out_TA_x;
     out_TA_x[0].setZero();
     out_TA_x[1].setZero();
     return out_TA_x;
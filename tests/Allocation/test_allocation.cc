@@ -0,0 +1,163 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *\
+ * Copyright (c) 2025, Davide Stocco and Enrico Bertolazzi.                                      *
+ *                                                                                               *
+ * The Sandals project is distributed under the BSD 2-Clause License.                            *
+ *                                                                                               *
+ * Davide Stocco                                                               Enrico Bertolazzi *
+ * University of Trento                                                     University of Trento *
+ * e-mail: davide.stocco@unitn.it                             e-mail: enrico.bertolazzi@unitn.it *
+\* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Eigen allocates through its own aligned malloc, not through operator new, hence its runtime
+// check is enabled and turned into an exception that the tests below can catch
+#include <stdexcept>
+#define EIGEN_RUNTIME_NO_MALLOC
+#define eigen_assert(X) do {if (!(X)) {throw std::runtime_error(#X);}} while (false)
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <gtest/gtest.h>
+
+#include "Sandals.hh"
+
+#include "Sandals/RungeKutta/Fehlberg45.hh"
+#include "Sandals/RungeKutta/GaussLegendre4.hh"
+#include "Sandals/RungeKutta/RadauIIA5.hh"
+#include "Sandals/RungeKutta/RK4.hh"
+#include "Sandals/RungeKutta/SSPIRK33.hh"
+
+#include "OscillatorImplicit.hh"
+#include "OscillatorSemiExplicit.hh"
+#include "SinCosExplicit.hh"
+#include "SinCosImplicit.hh"
+#include "SinCosSemiExplicit.hh"
+#include "ThreeBodySemiExplicit.hh"
+
+using namespace Sandals;
+using Real = double;
+
+// Replacing the global allocation functions makes GCC see its inlined free(...) calls as mismatched
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// Global operator new calls, counted only while the counter is armed
+static std::atomic<bool> counting{false};
+static std::atomic<long> allocations{0};
+
+void * operator new(std::size_t size)
+{
+  if (counting) {++allocations;}
+  if (void * ptr = std::malloc(size > 0 ? size : 1)) {return ptr;}
+  throw std::bad_alloc();
+}
+
+void * operator new[](std::size_t size) {return ::operator new(size);}
+void operator delete(void * ptr) noexcept {std::free(ptr);}
+void operator delete[](void * ptr) noexcept {std::free(ptr);}
+void operator delete(void * ptr, std::size_t) noexcept {std::free(ptr);}
+void operator delete[](void * ptr, std::size_t) noexcept {std::free(ptr);}
+
+// Advance the integrator for a number of fixed-size steps and return the number of heap
+// allocations per step (any Eigen heap allocation throws instead)
+template <typename Integrator, typename Vector>
+Real allocations_per_step(Integrator const & rk, Vector const & ics, Real const h, Integer const steps)
+{
+  Vector x_old(ics), x_new(ics);
+  Real t{0.0}, h_new{h};
+  bool success{true};
+  allocations = 0;
+  counting = true;
+  Eigen::internal::set_is_malloc_allowed(false);
+  try {
+    for (Integer i{0}; i < steps; ++i) {
+      success = success && rk.advance(x_old, t, h, x_new, h_new);
+      x_old = x_new;
+      t += h;
+    }
+  } catch (...) {
+    Eigen::internal::set_is_malloc_allowed(true);
+    counting = false;
+    throw;
+  }
+  Eigen::internal::set_is_malloc_allowed(true);
+  counting = false;
+  EXPECT_TRUE(success);
+  return static_cast<Real>(allocations) / static_cast<Real>(steps);
+}
+
+static const Real h{0.01};
+static const Integer steps{50};
+
+TEST(Allocation, ErkExplicit) {
+  RK4<Real, 2, 0> rk(std::make_shared<SinCosExplicit<Real>>());
+  EXPECT_EQ(allocations_per_step(rk, SinCosExplicit<Real>().ics(), h, steps), 0.0);
+}
+
+TEST(Allocation, ErkImplicit) {
+  RK4<Real, 2, 0> rk(std::make_shared<SinCosImplicit<Real>>());
+  EXPECT_EQ(allocations_per_step(rk, SinCosImplicit<Real>().ics(), h, steps), 0.0);
+}
+
+TEST(Allocation, Dirk) {
+  SSPIRK33<Real, 2, 0> rk(std::make_shared<SinCosImplicit<Real>>());
+  EXPECT_EQ(allocations_per_step(rk, SinCosImplicit<Real>().ics(), h, steps), 0.0);
+}
+
+TEST(Allocation, Irk) {
+  RadauIIA5<Real, 2, 0> rk(std::make_shared<SinCosImplicit<Real>>());
+  EXPECT_EQ(allocations_per_step(rk, SinCosImplicit<Real>().ics(), h, steps), 0.0);
+}
+
+TEST(Allocation, SemiExplicit) {
+  RadauIIA5<Real, 2, 0> rk(std::make_shared<SinCosSemiExplicit<Real>>());
+  EXPECT_EQ(allocations_per_step(rk, SinCosSemiExplicit<Real>().ics(), h, steps), 0.0);
+  GaussLegendre4<Real, 12, 0> rk_12(std::make_shared<ThreeBodySemiExplicit<Real>>());
+  EXPECT_EQ(allocations_per_step(rk_12, ThreeBodySemiExplicit<Real>().ics(), h, steps), 0.0);
+}
+
+TEST(Allocation, Projection) {
+  Fehlberg45<Real, 2, 1> rk(std::make_shared<OscillatorImplicit<Real>>());
+  rk.enable_projection();
+  EXPECT_EQ(allocations_per_step(rk, OscillatorImplicit<Real>().ics(), h, steps), 0.0);
+  SSPIRK33<Real, 2, 1> rk_se(std::make_shared<OscillatorSemiExplicit<Real>>());
+  rk_se.enable_projection();
+  EXPECT_EQ(allocations_per_step(rk_se, OscillatorSemiExplicit<Real>().ics(), h, steps), 0.0);
+}
+
+TEST(Allocation, Wrappers) {
+  using Vector = Eigen::Vector<Real, 2>;
+  using Matrix = Eigen::Matrix<Real, 2, 2>;
+  Matrix A;
+  A << 0.0, 1.0, -1.0, 0.0;
+  Vector ics(1.0, 0.0);
+
+  RK4<Real, 2, 0> rk_ex;
+  rk_ex.explicit_system(
+    [A](Vector const & x, Real const) -> Vector {return A*x;},
+    [A](Vector const &, Real const) -> Matrix {return A;});
+  EXPECT_EQ(allocations_per_step(rk_ex, ics, h, steps), 0.0);
+
+  RadauIIA5<Real, 2, 0> rk_im;
+  rk_im.implicit_system(
+    [A](Vector const & x, Vector const & x_dot, Real const) -> Vector {return x_dot - A*x;},
+    [A](Vector const &, Vector const &, Real const) -> Matrix {return -A;},
+    [](Vector const &, Vector const &, Real const) -> Matrix {return Matrix::Identity();});
+  EXPECT_EQ(allocations_per_step(rk_im, ics, h, steps), 0.0);
+
+  GaussLegendre4<Real, 2, 0> rk_se;
+  rk_se.semi_explicit_system(
+    [](Vector const &, Real const) -> Matrix {return Matrix::Identity();},
+    [](Vector const &, Real const) {return SemiExplicit<Real, 2, 0>::TensorTA{Matrix::Zero(), Matrix::Zero()};},
+    [A](Vector const & x, Real const) -> Vector {return A*x;},
+    [A](Vector const &, Real const) -> Matrix {return A;});
+  EXPECT_EQ(allocations_per_step(rk_se, ics, h, steps), 0.0);
+}
+
+// Run all the tests.
+int main(int argc, char **argv) {
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -49,7 +49,7 @@ public:
 
   TensorTA TA_x(VectorF const &/*x*/, Real /*t*/) const override
   {
-    TensorTA TA_x(2);
+    TensorTA TA_x;
     TA_x[0].setZero();
     TA_x[1].setZero();
     return TA_x;
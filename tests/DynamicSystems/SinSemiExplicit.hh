@@ -46,7 +46,7 @@ public:
 
   TensorTA TA_x(VectorF const &/*x*/, Real /*t*/) const override
   {
-    TensorTA TA_x(1);
+    TensorTA TA_x;
     TA_x[0].setZero();
     return TA_x;
   }
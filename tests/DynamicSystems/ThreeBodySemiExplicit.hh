@@ -117,7 +117,7 @@ public:
 
   TensorTA TA_x(VectorF const &/*x*/, Real /*t*/) const override
   {
-    TensorTA TA_x(12);
+    TensorTA TA_x;
     for (int i = 0; i < 12; ++i) {TA_x[i].setZero();}
     return TA_x;
   }
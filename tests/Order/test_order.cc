@@ -129,6 +129,19 @@ TEST(OrderExplicit, SSPRK43)        {SSPRK43<Real, 2> rk(ex_sys);        EXPECT_
 TEST(OrderExplicit, SSPRK93)        {SSPRK93<Real, 2> rk(ex_sys);        EXPECT_GE(rk.estimate_order(t, ics, sol), rk.order()-tolerance);}
 TEST(OrderExplicit, SSPRK104)       {SSPRK104<Real, 2> rk(ex_sys);       EXPECT_GE(rk.estimate_order(t, ics, sol), rk.order()-tolerance);}
 
+TEST(OrderParallel, Fehlberg45)     {Fehlberg45<Real, 2> rk(ex_sys);     EXPECT_DOUBLE_EQ(rk.estimate_order_parallel(t, ics, sol, 4), rk.estimate_order(t, ics, sol));}
+TEST(OrderParallel, GaussLegendre4) {GaussLegendre4<Real, 2> rk(im_sys); EXPECT_DOUBLE_EQ(rk.estimate_order_parallel(t, ics, sol, 4), rk.estimate_order(t, ics, sol));}
+TEST(OrderParallel, RadauIIA5)      {RadauIIA5<Real, 2> rk(im_sys);      EXPECT_DOUBLE_EQ(rk.estimate_order_parallel(t, ics, sol), rk.estimate_order(t, ics, sol));}
+TEST(OrderParallel, SSPIRK33)       {SSPIRK33<Real, 2> rk(im_sys);       EXPECT_DOUBLE_EQ(rk.estimate_order_parallel(t, ics, sol, 3), rk.estimate_order(t, ics, sol));}
+
+TEST(OrderFullNewton, GaussLegendre4) {GaussLegendre4<Real, 2> rk(im_sys); rk.disable_simplified_newton(); EXPECT_GE(rk.estimate_order(t, ics, sol), rk.order()-tolerance);}
+TEST(OrderFullNewton, RadauIIA5)      {RadauIIA5<Real, 2> rk(im_sys);      rk.disable_simplified_newton(); EXPECT_GE(rk.estimate_order(t, ics, sol), rk.order()-tolerance);}
+TEST(OrderFullNewton, SSPIRK33)       {SSPIRK33<Real, 2> rk(im_sys);       rk.disable_simplified_newton(); EXPECT_GE(rk.estimate_order(t, ics, sol), rk.order()-tolerance);}
+
+TEST(OrderNoPredictor, GaussLegendre4) {GaussLegendre4<Real, 2> rk(im_sys); rk.disable_predictor(); EXPECT_GE(rk.estimate_order(t, ics, sol), rk.order()-tolerance);}
+TEST(OrderNoPredictor, RadauIIA5)      {RadauIIA5<Real, 2> rk(im_sys);      rk.disable_predictor(); EXPECT_GE(rk.estimate_order(t, ics, sol), rk.order()-tolerance);}
+TEST(OrderNoPredictor, SSPIRK33)       {SSPIRK33<Real, 2> rk(im_sys);       rk.disable_predictor(); EXPECT_GE(rk.estimate_order(t, ics, sol), rk.order()-tolerance);}
+
 // Run all the tests.
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
@@ -67,6 +67,34 @@ TEST(Tableau, SSPRK43)        {SSPRK43Tableau<Real> tbl;        EXPECT_TRUE(tbl.
 TEST(Tableau, SSPRK93)        {SSPRK93Tableau<Real> tbl;        EXPECT_TRUE(tbl.check());}
 TEST(Tableau, SSPRK104)       {SSPRK104Tableau<Real> tbl;       EXPECT_TRUE(tbl.check());}
 
+TEST(Tableau, SDIRK) {
+  EXPECT_TRUE(SSPIRK33Tableau<Real>().is_sdirk());
+  EXPECT_FALSE(LobattoIIIA2Tableau<Real>().is_sdirk());
+  EXPECT_FALSE(RadauIIA5Tableau<Real>().is_sdirk());
+  EXPECT_FALSE(RK4Tableau<Real>().is_sdirk());
+}
+
+template <typename TableauType>
+void check_transform(TableauType const & tbl)
+{
+  typename TableauType::Matrix T, T_inv;
+  typename TableauType::VectorC lambda;
+  EXPECT_TRUE(tbl.transform(T, T_inv, lambda));
+  EXPECT_TRUE((T * T_inv).isIdentity(1.0e-10));
+  EXPECT_NEAR(lambda.sum().real(), tbl.A.trace(), 1.0e-10);
+  EXPECT_NEAR(lambda.sum().imag(), 0.0, 1.0e-10);
+}
+
+TEST(Tableau, Transform) {
+  check_transform(GaussLegendre2Tableau<Real>());
+  check_transform(GaussLegendre4Tableau<Real>());
+  check_transform(GaussLegendre6Tableau<Real>());
+  check_transform(ImplicitEulerTableau<Real>());
+  check_transform(LobattoIIIA2Tableau<Real>());
+  check_transform(RadauIIA3Tableau<Real>());
+  check_transform(RadauIIA5Tableau<Real>());
+}
+
 // Run all the tests.
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);